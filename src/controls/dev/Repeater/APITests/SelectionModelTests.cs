@@ -626,6 +626,52 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateInsertsAndRemovesWithScatteredSelection()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<int>(Enumerable.Range(0, 100));
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = data;
+
+                // Select every third item, plus a run that later gets split and merged again.
+                var expected = new List<int>();
+                for (int i = 0; i < data.Count; i += 3)
+                {
+                    selectionModel.Select(i);
+                    expected.Add(i);
+                }
+
+                selectionModel.SelectRange(Path(40), Path(49));
+                expected = expected.Union(Enumerable.Range(40, 10)).OrderBy(i => i).ToList();
+                ValidateScatteredSelection(selectionModel, expected);
+
+                Log.Comment("Insert in the middle of the selected run: Inserting item at index 45");
+                data.Insert(45, 1000);
+                expected = expected.Select(i => i >= 45 ? i + 1 : i).ToList();
+                ValidateScatteredSelection(selectionModel, expected);
+
+                Log.Comment("Remove the inserted item, joining the run again: Removing item at index 45");
+                data.RemoveAt(45);
+                expected = expected.Select(i => i > 45 ? i - 1 : i).ToList();
+                ValidateScatteredSelection(selectionModel, expected);
+
+                Log.Comment("Deselect the middle of the run: Deselecting 43 to 46");
+                selectionModel.DeselectRange(Path(43), Path(46));
+                expected = expected.Where(i => i < 43 || i > 46).ToList();
+                ValidateScatteredSelection(selectionModel, expected);
+
+                Log.Comment("Remove selected and unselected items: Removing items at index 2 to 9");
+                for (int i = 0; i < 8; i++)
+                {
+                    data.RemoveAt(2);
+                }
+                expected = expected.Where(i => i < 2 || i > 9).Select(i => i > 9 ? i - 8 : i).ToList();
+                ValidateScatteredSelection(selectionModel, expected);
+            });
+        }
+
         [TestMethod]
         public void ValidateGroupRemoves()
         {
@@ -1374,6 +1420,23 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             Log.Comment("Validating Selection... done");
         }
 
+        private void ValidateScatteredSelection(SelectionModel selectionModel, List<int> expectedSelected)
+        {
+            var data = (IList)selectionModel.Source;
+            for (int i = 0; i < data.Count; i++)
+            {
+                Verify.AreEqual(expectedSelected.Contains(i), selectionModel.IsSelected(i).Value, i + " is Selected");
+            }
+
+            var selectedIndices = selectionModel.SelectedIndices;
+            Verify.AreEqual(expectedSelected.Count, selectedIndices.Count);
+            for (int i = 0; i < expectedSelected.Count; i++)
+            {
+                Verify.AreEqual(expectedSelected[i], selectedIndices[i].GetAt(0));
+                Verify.AreEqual(data[expectedSelected[i]], selectionModel.SelectedItems[i]);
+            }
+        }
+
         private object GetData(SelectionModel selectionModel, IndexPath indexPath)
         {
             var data = selectionModel.Source;
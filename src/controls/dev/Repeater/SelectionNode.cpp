@@ -44,7 +44,6 @@ void SelectionNode::Source(const winrt::IInspectable& value)
         m_dataSource.set(newDataSource);
 
         HookupCollectionChangedHandler();
-        OnSelectionChanged();
     }
 }
 
@@ -165,22 +164,12 @@ std::shared_ptr<SelectionNode> SelectionNode::GetAt(int index, bool realizeChild
 
 int SelectionNode::SelectedCount()
 {
-    return m_selectedCount;
+    return m_selected.Count();
 }
 
 bool SelectionNode::IsSelected(int index)
 {
-    bool isSelected = false;
-    for (auto& range : m_selected)
-    {
-        if (range.Contains(index))
-        {
-            isSelected = true;
-            break;
-        }
-    }
-
-    return isSelected;
+    return m_selected.Contains(index);
 }
 
 // True  -> Selected
@@ -233,7 +222,7 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial(int index)
 
 int SelectionNode::SelectedIndex()
 {
-    return SelectedCount() > 0 ? SelectedIndices().at(0) : -1;
+    return SelectedCount() > 0 ? SelectedIndexAt(0) : -1;
 }
 
 void SelectionNode::SelectedIndex(int value)
@@ -249,33 +238,10 @@ void SelectionNode::SelectedIndex(int value)
     }
 }
 
-std::vector<int> SelectionNode::SelectedIndices()
-{
-    if (!m_selectedIndicesCacheIsValid)
-    {
-        m_selectedIndicesCacheIsValid = true;
-        for (auto& range : m_selected)
-        {
-            for (int index = range.Begin(); index <= range.End(); index++)
-            {
-                // Avoid duplicates
-                if (std::find(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end(), index) == m_selectedIndicesCached.end())
-                {
-                    m_selectedIndicesCached.emplace_back(index);
-                }
-            }
-        }
-
-        // Sort the list for easy consumption
-        std::sort(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end());
-    }
-
-    return m_selectedIndicesCached;
-}
-
-bool SelectionNode::Select(int index, bool select)
+int SelectionNode::SelectedIndexAt(int ordinal)
 {
-    return Select(index, select, true /* raiseOnSelectionChanged */);
+    MUX_ASSERT(0 <= ordinal && ordinal < SelectedCount());
+    return m_selected.At(ordinal);
 }
 
 bool SelectionNode::ToggleSelect(int index)
@@ -306,11 +272,11 @@ bool SelectionNode::SelectRange(const IndexRange& range, bool select)
     {
         if (select)
         {
-            AddRange(range, true /* raiseOnSelectionChanged */);
+            AddRange(range);
         }
         else
         {
-            RemoveRange(range, true /* raiseOnSelectionChanged */);
+            RemoveRange(range);
         }
 
         return true;
@@ -337,121 +303,22 @@ bool SelectionNode::IsValidIndex(int index)
     return (ItemsSourceView() == nullptr || (index >= 0 && index < ItemsSourceView().Count()));
 }
 
-void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged)
+void SelectionNode::AddRange(const IndexRange& addRange)
 {
-    // TODO: Check for duplicates (Task 14107720)
-    // TODO: Optimize by merging adjacent ranges (Task 14107720)
-
-    const int oldCount = SelectedCount();
-
-    for (int i = addRange.Begin(); i <= addRange.End(); i++)
-    {
-        if (!IsSelected(i))
-        {
-            m_selectedCount++;
-        }
-    }
-
-    if (oldCount != m_selectedCount)
-    {
-        m_selected.emplace_back(addRange);
-
-        if (raiseOnSelectionChanged)
-        {
-            OnSelectionChanged();
-        }
-    }
+    // Overlapping and adjacent ranges are merged, so this only selects what wasn't selected already.
+    m_selected.Add(addRange);
 }
 
-void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged)
+void SelectionNode::RemoveRange(const IndexRange& removeRange)
 {
-    const int oldCount = m_selectedCount;
-
-    // TODO: Prevent overlap of Ranges in _selected (Task 14107720)
-    for (int i = removeRange.Begin(); i <= removeRange.End(); i++)
-    {
-        if (IsSelected(i))
-        {
-            m_selectedCount--;
-        }
-    }
-
-    if (oldCount != m_selectedCount)
-    {
-        // Build up a both a list of Ranges to remove and ranges to add
-        std::vector<IndexRange> toRemove;
-        std::vector<IndexRange> toAdd;
-
-        for (IndexRange& range : m_selected)
-        {
-            // If this range intersects the remove range, we have to do something
-            if (removeRange.Intersects(range))
-            {
-                IndexRange before(-1, -1);
-                IndexRange cut(-1, -1);
-                IndexRange after(-1, -1);
-
-                // Intersection with the beginning of the range
-                //  Anything to the left of the point (exclusive) stays
-                //  Anything to the right of the point (inclusive) gets clipped
-                if (range.Contains(removeRange.Begin() - 1))
-                {
-                    range.Split(removeRange.Begin() - 1, before, cut);
-                    toAdd.emplace_back(before);
-                }
-
-                // Intersection with the end of the range
-                //  Anything to the left of the point (inclusive) gets clipped
-                //  Anything to the right of the point (exclusive) stays
-                if (range.Contains(removeRange.End()))
-                {
-                    if (range.Split(removeRange.End(), cut, after))
-                    {
-                        toAdd.emplace_back(after);
-                    }
-                }
-
-                // Remove this Range from the collection
-                // New ranges will be added for any remaining subsections
-                toRemove.emplace_back(range);
-            }
-        }
-
-        const bool change = ((toRemove.size() > 0) || (toAdd.size() > 0));
-
-        if (change)
-        {
-            // Remove tagged ranges
-            for (const IndexRange& remove : toRemove)
-            {
-                auto iter = std::find(m_selected.begin(), m_selected.end(), remove);
-                m_selected.erase(iter);
-            }
-
-            // Add new ranges
-            for (const IndexRange& add : toAdd)
-            {
-                m_selected.emplace_back(add);
-            }
-
-            if (raiseOnSelectionChanged)
-            {
-                OnSelectionChanged();
-            }
-        }
-    }
+    // Ranges that straddle the removed range keep the parts outside of it.
+    m_selected.Remove(removeRange);
 }
 
 void SelectionNode::ClearSelection()
 {
     // Deselect all items
-    if (m_selected.size() > 0)
-    {
-        m_selected.clear();
-        OnSelectionChanged();
-    }
-
-    m_selectedCount = 0;
+    m_selected.Clear();
     AnchorIndex(-1);
 
     // This will throw away all the children SelectionNodes
@@ -460,7 +327,7 @@ void SelectionNode::ClearSelection()
     m_childrenNodes.clear();
 }
 
-bool SelectionNode::Select(int index, bool select, bool raiseOnSelectionChanged)
+bool SelectionNode::Select(int index, bool select)
 {
     if (IsValidIndex(index))
     {
@@ -474,11 +341,11 @@ bool SelectionNode::Select(int index, bool select, bool raiseOnSelectionChanged)
 
         if (select)
         {
-            AddRange(range, raiseOnSelectionChanged);
+            AddRange(range);
         }
         else
         {
-            RemoveRange(range, raiseOnSelectionChanged);
+            RemoveRange(range);
         }
 
         return true;
@@ -521,7 +388,6 @@ void SelectionNode::OnSourceListChanged(const winrt::IInspectable& dataSource, c
 
     if (selectionInvalidated)
     {
-        OnSelectionChanged();
         m_manager->OnSelectionInvalidatedDueToCollectionChange();
     }
 }
@@ -529,39 +395,11 @@ void SelectionNode::OnSourceListChanged(const winrt::IInspectable& dataSource, c
 bool SelectionNode::OnItemsAdded(int index, int count)
 {
     bool selectionInvalidated = false;
-    // Update ranges for leaf items
-    std::vector<IndexRange> toAdd;
-    for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
-    {
-        auto range = m_selected[i];
-
-        // The range is after the inserted items, need to shift the range right
-        if (range.End() >= index)
-        {
-            int begin = range.Begin();
-            // If the index left of newIndex is inside the range,
-            // Split the range and remember the left piece to add later
-            if (range.Contains(index - 1))
-            {
-                IndexRange before(-1, -1), after(-1, -1);
-                range.Split(index - 1, before, after);
-                toAdd.emplace_back(before);
-                begin = index;
-            }
-
-            // Shift the range to the right
-            m_selected[i] = IndexRange(begin + count, range.End() + count);
-            selectionInvalidated = true;
-        }
-    }
-
-    if (toAdd.size() > 0)
+    // Update ranges for leaf items. Ranges after the inserted items are shifted right, and a range
+    // containing the insertion point is split so that only its right piece moves.
+    if (m_selected.ShiftFrom(index, count))
     {
-        // Add the left sides of the split ranges
-        for (auto& add : toAdd)
-        {
-            m_selected.emplace_back(add);
-        }
+        selectionInvalidated = true;
     }
 
     // Update for non-leaf if we are tracking non-leaf nodes
@@ -610,33 +448,16 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     // Remove the items from the selection for leaf
     if (ItemsSourceView().Count() > 0)
     {
-        bool isSelected = false;
-        for (int i = index; i <= index + count - 1; i++)
+        if (count > 0)
         {
-            if (IsSelected(i))
+            if (m_selected.Remove(IndexRange(index, index + count - 1)) > 0)
             {
-                isSelected = true;
-                break;
+                selectionInvalidated = true;
             }
-        }
-
-        if (isSelected)
-        {
-            RemoveRange(IndexRange(index, index + count - 1), false /* raiseOnSelectionChanged */);
-            selectionInvalidated = true;
-        }
 
-        for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
-        {
-            auto range = m_selected[i];
-
-            // The range is after the removed items, need to shift the range left
-            if (range.End() > index)
+            // Shift the ranges after the removed items to the left
+            if (m_selected.ShiftFrom(index + count, -count))
             {
-                MUX_ASSERT(!range.Contains(index));
-
-                // Shift the range to the left
-                m_selected[i] = IndexRange(range.Begin() - count, range.End() - count);
                 selectionInvalidated = true;
             }
         }
@@ -693,12 +514,6 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     return selectionInvalidated;
 }
 
-void SelectionNode::OnSelectionChanged()
-{
-    m_selectedIndicesCacheIsValid = false;
-    m_selectedIndicesCached.clear();
-}
-
 /* static */
 winrt::IReference<bool> SelectionNode::ConvertToNullableBool(SelectionState isSelected)
 {
@@ -0,0 +1,424 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "SelectionRangeTree.h"
+
+int SelectionRangeTree::Count() const
+{
+    return CountOf(m_root);
+}
+
+bool SelectionRangeTree::Empty() const
+{
+    return m_root == c_null;
+}
+
+bool SelectionRangeTree::Contains(int index) const
+{
+    // Offsets pending on the ancestors of a node haven't been applied to it yet, so
+    // accumulate them on the way down instead of pushing them.
+    int offset = 0;
+    int node = m_root;
+    while (node != c_null)
+    {
+        const Node& current = m_nodes[node];
+        if (index < current.Begin + offset)
+        {
+            offset += current.PendingOffset;
+            node = current.Left;
+        }
+        else if (index > current.End + offset)
+        {
+            offset += current.PendingOffset;
+            node = current.Right;
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int SelectionRangeTree::At(int ordinal) const
+{
+    MUX_ASSERT(ordinal >= 0 && ordinal < Count());
+
+    int offset = 0;
+    int node = m_root;
+    while (node != c_null)
+    {
+        const Node& current = m_nodes[node];
+        const int leftCount = CountOf(current.Left);
+        const int length = current.End - current.Begin + 1;
+        if (ordinal < leftCount)
+        {
+            offset += current.PendingOffset;
+            node = current.Left;
+        }
+        else if (ordinal < leftCount + length)
+        {
+            return current.Begin + offset + (ordinal - leftCount);
+        }
+        else
+        {
+            ordinal -= leftCount + length;
+            offset += current.PendingOffset;
+            node = current.Right;
+        }
+    }
+
+    return -1;
+}
+
+int SelectionRangeTree::Add(const IndexRange& range)
+{
+    int before = c_null;
+    int rest = c_null;
+    int overlapping = c_null;
+    int after = c_null;
+
+    // Find the ranges that start inside the new range, or right after it.
+    Split(m_root, range.Begin(), before, rest);
+    Split(rest, range.End() + 2, overlapping, after);
+
+    int begin = range.Begin();
+    int end = range.End();
+    int alreadySelected = CountOf(overlapping);
+
+    if (overlapping != c_null)
+    {
+        const int last = PopLast(overlapping);
+        end = std::max(end, m_nodes[last].End);
+        FreeNode(last);
+        FreeSubtree(overlapping);
+    }
+
+    // The range that starts before the new one might overlap it or touch it too.
+    if (before != c_null)
+    {
+        const int last = PopLast(before);
+        if (m_nodes[last].End >= range.Begin() - 1)
+        {
+            alreadySelected += m_nodes[last].End - m_nodes[last].Begin + 1;
+            begin = m_nodes[last].Begin;
+            end = std::max(end, m_nodes[last].End);
+            FreeNode(last);
+        }
+        else
+        {
+            before = Merge(before, last);
+        }
+    }
+
+    const int node = NewNode(begin, end);
+    m_root = Merge(Merge(before, node), after);
+
+    return (end - begin + 1) - alreadySelected;
+}
+
+int SelectionRangeTree::Remove(const IndexRange& range)
+{
+    int before = c_null;
+    int rest = c_null;
+    int overlapping = c_null;
+    int after = c_null;
+
+    Split(m_root, range.Begin(), before, rest);
+    Split(rest, range.End() + 1, overlapping, after);
+
+    int removed = CountOf(overlapping);
+
+    if (overlapping != c_null)
+    {
+        // The last range starting inside the removed range might extend past it.
+        const int last = PopLast(overlapping);
+        if (m_nodes[last].End > range.End())
+        {
+            removed -= m_nodes[last].End - range.End();
+            m_nodes[last].Begin = range.End() + 1;
+            Update(last);
+            after = Merge(last, after);
+        }
+        else
+        {
+            FreeNode(last);
+        }
+
+        FreeSubtree(overlapping);
+    }
+
+    // The range that starts before the removed range might extend into it, or even past it.
+    if (before != c_null)
+    {
+        const int last = PopLast(before);
+        const int end = m_nodes[last].End;
+        if (end >= range.Begin())
+        {
+            removed += std::min(end, range.End()) - range.Begin() + 1;
+            m_nodes[last].End = range.Begin() - 1;
+            Update(last);
+
+            if (end > range.End())
+            {
+                after = Merge(NewNode(range.End() + 1, end), after);
+            }
+        }
+
+        before = Merge(before, last);
+    }
+
+    m_root = Merge(before, after);
+
+    return removed;
+}
+
+bool SelectionRangeTree::ShiftFrom(int index, int delta)
+{
+    int before = c_null;
+    int after = c_null;
+
+    Split(m_root, index, before, after);
+
+    // Split a range that straddles the index so that only its tail moves.
+    if (before != c_null)
+    {
+        const int last = PopLast(before);
+        const int end = m_nodes[last].End;
+        if (end >= index)
+        {
+            m_nodes[last].End = index - 1;
+            Update(last);
+            after = Merge(NewNode(index, end), after);
+        }
+
+        before = Merge(before, last);
+    }
+
+    const bool shifted = (after != c_null);
+    if (shifted)
+    {
+        ApplyOffset(after, delta);
+    }
+
+    // Moving ranges left can make them touch the ones before the index.
+    m_root = Join(before, after);
+
+    return shifted;
+}
+
+void SelectionRangeTree::Clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_root = c_null;
+}
+
+int SelectionRangeTree::NewNode(int begin, int end)
+{
+    MUX_ASSERT(begin <= end);
+
+    // xorshift32, the priorities only need to be well spread.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    const Node node{ begin, end, c_null, c_null, end - begin + 1, 0, m_seed };
+
+    int index;
+    if (!m_freeNodes.empty())
+    {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[index] = node;
+    }
+    else
+    {
+        index = static_cast<int>(m_nodes.size());
+        m_nodes.push_back(node);
+    }
+
+    return index;
+}
+
+void SelectionRangeTree::FreeNode(int node)
+{
+    m_freeNodes.push_back(node);
+}
+
+void SelectionRangeTree::FreeSubtree(int node)
+{
+    if (node != c_null)
+    {
+        FreeSubtree(m_nodes[node].Left);
+        FreeSubtree(m_nodes[node].Right);
+        FreeNode(node);
+    }
+}
+
+void SelectionRangeTree::ApplyOffset(int node, int offset)
+{
+    if (node != c_null)
+    {
+        Node& current = m_nodes[node];
+        current.Begin += offset;
+        current.End += offset;
+        current.PendingOffset += offset;
+    }
+}
+
+void SelectionRangeTree::PushDown(int node)
+{
+    Node& current = m_nodes[node];
+    if (current.PendingOffset != 0)
+    {
+        ApplyOffset(current.Left, current.PendingOffset);
+        ApplyOffset(current.Right, current.PendingOffset);
+        current.PendingOffset = 0;
+    }
+}
+
+void SelectionRangeTree::Update(int node)
+{
+    Node& current = m_nodes[node];
+    current.Count = (current.End - current.Begin + 1) + CountOf(current.Left) + CountOf(current.Right);
+}
+
+int SelectionRangeTree::CountOf(int node) const
+{
+    return node != c_null ? m_nodes[node].Count : 0;
+}
+
+void SelectionRangeTree::Split(int tree, int index, int& before, int& after)
+{
+    if (tree == c_null)
+    {
+        before = c_null;
+        after = c_null;
+        return;
+    }
+
+    PushDown(tree);
+    if (m_nodes[tree].Begin < index)
+    {
+        int right = c_null;
+        Split(m_nodes[tree].Right, index, right, after);
+        m_nodes[tree].Right = right;
+        before = tree;
+    }
+    else
+    {
+        int left = c_null;
+        Split(m_nodes[tree].Left, index, before, left);
+        m_nodes[tree].Left = left;
+        after = tree;
+    }
+
+    Update(tree);
+}
+
+int SelectionRangeTree::Merge(int left, int right)
+{
+    if (left == c_null)
+    {
+        return right;
+    }
+
+    if (right == c_null)
+    {
+        return left;
+    }
+
+    if (m_nodes[left].Priority > m_nodes[right].Priority)
+    {
+        PushDown(left);
+        m_nodes[left].Right = Merge(m_nodes[left].Right, right);
+        Update(left);
+        return left;
+    }
+    else
+    {
+        PushDown(right);
+        m_nodes[right].Left = Merge(left, m_nodes[right].Left);
+        Update(right);
+        return right;
+    }
+}
+
+int SelectionRangeTree::PopLast(int& tree)
+{
+    MUX_ASSERT(tree != c_null);
+
+    PushDown(tree);
+
+    int last;
+    if (m_nodes[tree].Right == c_null)
+    {
+        last = tree;
+        tree = m_nodes[last].Left;
+        m_nodes[last].Left = c_null;
+        Update(last);
+    }
+    else
+    {
+        int right = m_nodes[tree].Right;
+        last = PopLast(right);
+        m_nodes[tree].Right = right;
+        Update(tree);
+    }
+
+    return last;
+}
+
+int SelectionRangeTree::PopFirst(int& tree)
+{
+    MUX_ASSERT(tree != c_null);
+
+    PushDown(tree);
+
+    int first;
+    if (m_nodes[tree].Left == c_null)
+    {
+        first = tree;
+        tree = m_nodes[first].Right;
+        m_nodes[first].Right = c_null;
+        Update(first);
+    }
+    else
+    {
+        int left = m_nodes[tree].Left;
+        first = PopFirst(left);
+        m_nodes[tree].Left = left;
+        Update(tree);
+    }
+
+    return first;
+}
+
+int SelectionRangeTree::Join(int left, int right)
+{
+    if (left != c_null && right != c_null)
+    {
+        const int last = PopLast(left);
+        const int first = PopFirst(right);
+
+        MUX_ASSERT(m_nodes[last].End < m_nodes[first].Begin);
+
+        if (m_nodes[last].End + 1 == m_nodes[first].Begin)
+        {
+            m_nodes[last].End = m_nodes[first].End;
+            Update(last);
+            FreeNode(first);
+        }
+        else
+        {
+            right = Merge(first, right);
+        }
+
+        left = Merge(left, last);
+    }
+
+    return Merge(left, right);
+}
@@ -0,0 +1,81 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+#include "IndexRange.h"
+
+// Stores the selected indices of a SelectionNode as a set of disjoint, non-adjacent ranges.
+// The ranges live in a treap ordered by their first index. Every node tracks the number of
+// indices selected in its subtree, which makes IsSelected and finding the n-th selected index
+// O(log n) in the number of ranges. Shifting every range after an index (when items are
+// inserted into or removed from the source) is applied lazily to a whole subtree, so it is
+// O(log n) as well instead of touching every range that follows.
+class SelectionRangeTree final
+{
+public:
+    SelectionRangeTree() = default;
+
+    // Number of selected indices.
+    int Count() const;
+    bool Empty() const;
+
+    bool Contains(int index) const;
+
+    // Returns the selected index at the given position in sorted order.
+    int At(int ordinal) const;
+
+    // Returns the number of indices that were not selected before.
+    int Add(const IndexRange& range);
+
+    // Returns the number of indices that were selected before.
+    int Remove(const IndexRange& range);
+
+    // Shifts every selected index at or after 'index' by 'delta'. A range that contains 'index'
+    // is split so that only its tail moves. When delta is negative, the indices in
+    // [index + delta, index - 1] must not be selected. Returns whether any index was shifted.
+    bool ShiftFrom(int index, int delta);
+
+    void Clear();
+
+private:
+    static constexpr int c_null = -1;
+
+    struct Node
+    {
+        int Begin;
+        int End;
+        int Left;
+        int Right;
+        // Number of indices selected in this subtree.
+        int Count;
+        // Offset still to be applied to the children of this node. Begin and End of the node
+        // itself are always up to date.
+        int PendingOffset;
+        uint32_t Priority;
+    };
+
+    int NewNode(int begin, int end);
+    void FreeNode(int node);
+    void FreeSubtree(int node);
+
+    void ApplyOffset(int node, int offset);
+    void PushDown(int node);
+    void Update(int node);
+    int CountOf(int node) const;
+
+    // Splits the tree into the ranges that begin before 'index' and the rest.
+    void Split(int tree, int index, int& before, int& after);
+    int Merge(int left, int right);
+
+    // Detaches the last/first range of a tree.
+    int PopLast(int& tree);
+    int PopFirst(int& tree);
+
+    // Joins two trees whose ranges are ordered, coalescing the ranges where they meet if needed.
+    int Join(int left, int right);
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeNodes;
+    int m_root{ c_null };
+    uint32_t m_seed{ 0x9e3779b9 };
+};
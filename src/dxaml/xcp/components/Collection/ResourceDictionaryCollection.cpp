@@ -131,6 +131,7 @@ CResourceDictionaryCollection::OnAddToCollection(_In_ CDependencyObject *pDO)
         // since potentially they could have been added.  Clearing is faster and more practical than invalidating individual keys.
 
         parentDictionary->InvalidateNotFoundCache(true);
+        parentDictionary->IncrementVersion();
     }
 
     pDictionary->SetResourceOwner(m_pResourceOwner);
@@ -165,6 +166,11 @@ CResourceDictionaryCollection::OnRemoveFromCollection(_In_ CDependencyObject *pD
     }
     pDictionary->SetResourceOwner(nullptr);
 
+    if (CResourceDictionary* parentDictionary = do_pointer_cast<CResourceDictionary>(GetParentInternal(false)))
+    {
+        parentDictionary->IncrementVersion();
+    }
+
     IFC_RETURN(CDOCollection::OnRemoveFromCollection(pDO, iPreviousIndex));
 
     return S_OK;
@@ -214,6 +220,11 @@ CResourceDictionaryCollection::Clear()
 
     IFC(CDOCollection::Clear());
 
+    if (CResourceDictionary* parentDictionary = do_pointer_cast<CResourceDictionary>(GetParentInternal(false)))
+    {
+        parentDictionary->IncrementVersion();
+    }
+
     if (pOldDictionaries)
     {
         IFC(pOldDictionaries->InvalidateImplicitStyles());
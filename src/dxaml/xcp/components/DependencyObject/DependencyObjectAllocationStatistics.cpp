@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "DependencyObjectAllocationStatistics.h"
+#include "CDependencyObject.h"
+#include "XcpSlabAllocator.h"
+
+#if DBG
+
+namespace
+{
+    // Objects are created on the UI threads of all the cores, so the counters are updated
+    // with interlocked operations.
+    struct AtomicTypeStatistics
+    {
+        volatile LONG CreatedCount;
+        volatile LONG DestroyedCount;
+        volatile LONG64 CreatedSlabBytes;
+    };
+
+    AtomicTypeStatistics s_typeStatistics[KnownTypeCount] = {};
+
+    AtomicTypeStatistics& GetTypeStatistics(_In_ KnownTypeIndex typeIndex)
+    {
+        const UINT16 index = static_cast<UINT16>(typeIndex);
+        return s_typeStatistics[(index < KnownTypeCount) ? index : static_cast<UINT16>(KnownTypeIndex::UnknownType)];
+    }
+}
+
+void DependencyObjectAllocationStatistics::OnCreated(_In_ const CDependencyObject* pObject)
+{
+    if (XcpAllocation::IsSlabAllocatorEnabled())
+    {
+        auto& statistics = GetTypeStatistics(pObject->GetTypeIndex());
+
+        InterlockedIncrement(&statistics.CreatedCount);
+        InterlockedAdd64(&statistics.CreatedSlabBytes, static_cast<LONG64>(XcpAllocation::GetSlabBlockSize(pObject)));
+    }
+}
+
+void DependencyObjectAllocationStatistics::OnDestroyed(_In_ const CDependencyObject* pObject)
+{
+    if (XcpAllocation::IsSlabAllocatorEnabled())
+    {
+        InterlockedIncrement(&GetTypeStatistics(pObject->GetTypeIndex()).DestroyedCount);
+    }
+}
+
+DependencyObjectAllocationStatistics::TypeStatistics DependencyObjectAllocationStatistics::GetStatistics(_In_ KnownTypeIndex typeIndex)
+{
+    const auto& statistics = GetTypeStatistics(typeIndex);
+
+    TypeStatistics result;
+    result.CreatedCount = static_cast<XUINT32>(statistics.CreatedCount);
+    result.DestroyedCount = static_cast<XUINT32>(statistics.DestroyedCount);
+    result.CreatedSlabBytes = static_cast<XUINT64>(statistics.CreatedSlabBytes);
+
+    return result;
+}
+
+void DependencyObjectAllocationStatistics::Reset()
+{
+    for (auto& statistics : s_typeStatistics)
+    {
+        InterlockedExchange(&statistics.CreatedCount, 0);
+        InterlockedExchange(&statistics.DestroyedCount, 0);
+        InterlockedExchange64(&statistics.CreatedSlabBytes, 0);
+    }
+}
+
+#endif
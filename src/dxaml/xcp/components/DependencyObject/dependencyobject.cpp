@@ -8,6 +8,7 @@
 #include <UIElement.h>
 #include <dopointercast.h>
 #include <TypeTableStructs.h>
+#include <DependencyObjectAllocationStatistics.h>
 #include <GridLength.h>
 #include <UIAEnums.h>
 #include <EnumDefs.h>
@@ -386,6 +387,9 @@ _Check_return_ HRESULT CDependencyObject::ClearRealizingProxy()
 _Check_return_ HRESULT CDependencyObject::ValidateAndInit(_In_ CDependencyObject *pDO, _Out_ CDependencyObject **ppDO)
 {
     IFC_RETURN(pDO->InitInstance());
+#if DBG
+    DependencyObjectAllocationStatistics::OnCreated(pDO);
+#endif
    *ppDO = pDO;
 
     return S_OK;
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "Indexes.g.h"
+
+class CDependencyObject;
+
+// Counts the core objects of each type while the slab allocator is enabled, to see which types a
+// page spends its allocations on. Objects are counted as created when they're made through the
+// type table (which is how the parser makes them), and as destroyed on their final release, so
+// objects made directly with new only show up in the destroyed count. Debug builds only, to keep
+// the interlocked updates off the creation and release of every object.
+#if DBG
+namespace DependencyObjectAllocationStatistics
+{
+    struct TypeStatistics
+    {
+        XUINT32 CreatedCount;
+        XUINT32 DestroyedCount;
+        XUINT64 CreatedSlabBytes;   // Bytes of slab blocks taken by the created objects.
+    };
+
+    void OnCreated(_In_ const CDependencyObject* pObject);
+    void OnDestroyed(_In_ const CDependencyObject* pObject);
+
+    // Custom types are counted under UnknownType.
+    TypeStatistics GetStatistics(_In_ KnownTypeIndex typeIndex);
+    void Reset();
+}
+#endif
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <wil\common.h>
+
+// Size-class slab allocator for the small objects the framework creates and destroys in large
+// numbers, like the core dependency objects and their sparse property storage.
+//
+// Blocks are carved out of 64K chunks in one reserved address range, every chunk holding blocks
+// of a single size class. On low memory, chunks whose blocks are all free are decommitted, and can
+// later be committed again for any size class. Each thread keeps free lists of its own, so the objects of a core are
+// allocated and recycled on its UI thread without taking a lock. Threads only go to the shared
+// lists in batches, when their own list is empty or has grown too long.
+//
+// The allocator is opt-in, see the UseSlabAllocator runtime feature. While it's off, and for
+// sizes over c_maxSlabBlockSize, allocations go through the regular operator new. Freeing tells
+// the two apart by address, so turning it on doesn't affect objects that already exist.
+
+namespace XcpAllocation {
+
+    constexpr size_t c_slabGranularity = 16;
+    constexpr size_t c_maxSlabBlockSize = 1024;
+    constexpr size_t c_slabSizeClassCount = c_maxSlabBlockSize / c_slabGranularity;
+
+    struct SlabSizeClassStatistics
+    {
+        size_t BlockSize;
+        size_t ChunkCount;          // Committed chunks holding blocks of this size.
+        size_t SharedFreeCount;     // Free blocks not cached by any thread.
+    };
+
+    void EnableSlabAllocator();
+    bool IsSlabAllocatorEnabled();
+
+    _Check_return_ __declspec(allocator) void *SlabAllocate(_In_ size_t cSize);
+    void SlabFree(_Frees_ptr_opt_ void *pAddress);
+
+    // Gives the chunks that hold no objects back to the system. Free blocks cached by threads other
+    // than the calling one keep their chunks committed.
+    void TrimSlabAllocator();
+
+    // Size of the block holding the address, or 0 if it wasn't allocated from a slab.
+    size_t GetSlabBlockSize(_In_opt_ const void *pAddress);
+
+    void GetSlabStatistics(_Out_writes_(c_slabSizeClassCount) SlabSizeClassStatistics *pStatistics);
+
+    // Lets STL containers keep their storage in slabs.
+    template <typename T>
+    struct SlabStlAllocator
+    {
+        typedef T value_type;
+
+        __declspec(allocator) T* allocate(size_t n) const
+        {
+            if (n > static_cast<size_t>(-1) / sizeof(T))
+            {
+                // Prevent overflow
+                XAML_FAIL_FAST();
+            }
+
+            return static_cast<T*>(SlabAllocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t) const WI_NOEXCEPT
+        {
+            SlabFree(ptr);
+        }
+
+        SlabStlAllocator() WI_NOEXCEPT {}
+        SlabStlAllocator(const SlabStlAllocator&) WI_NOEXCEPT {}
+        template <typename U> SlabStlAllocator(const SlabStlAllocator<U>&) WI_NOEXCEPT {}
+        template <typename U> bool operator==(
+            const SlabStlAllocator<U>&) const WI_NOEXCEPT { return true; }
+        template <typename U> bool operator!=(
+            const SlabStlAllocator<U>&) const WI_NOEXCEPT { return false; }
+        template <typename U> struct rebind {
+            typedef SlabStlAllocator<U> other;
+        };
+    };
+}
@@ -0,0 +1,423 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "XcpAllocation.h"
+#include "XcpSlabAllocator.h"
+#include "XAMLTerminateProcessOnOOM.h"
+#include <algorithm>
+#include <atomic>
+#include <wil\resource.h>
+
+using namespace XcpAllocation;
+
+namespace
+{
+    constexpr size_t c_chunkSize = 64 * 1024;
+
+#if defined(_WIN64)
+    constexpr size_t c_reservationSize = 1024 * 1024 * 1024;
+#else
+    constexpr size_t c_reservationSize = 128 * 1024 * 1024;
+#endif
+
+    constexpr size_t c_chunkCount = c_reservationSize / c_chunkSize;
+
+    // A thread hands half of its free blocks of a size class back to the shared list once it
+    // holds this many, and takes up to c_refillCount at a time from it.
+    constexpr XUINT32 c_maxThreadFreeCount = 256;
+    constexpr XUINT32 c_refillCount = 64;
+
+    struct FreeBlock
+    {
+        FreeBlock* pNext;
+    };
+
+    struct ThreadCache
+    {
+        ~ThreadCache();
+
+        FreeBlock* freeLists[c_slabSizeClassCount] = {};
+        XUINT32 freeCounts[c_slabSizeClassCount] = {};
+    };
+
+    // The start of the reserved range is published once, everything else is guarded by the lock.
+    // The size class of a chunk is written before any of its blocks is handed out, so it can be
+    // read without the lock by whoever frees one of them.
+    std::atomic<XUINT8*> s_pBase = nullptr;
+    std::atomic<bool> s_isEnabled = false;
+
+    SRWLOCK s_lock = SRWLOCK_INIT;
+
+    // Chunks at or past this index have never been committed.
+    size_t s_usedChunkCount = 0;
+
+    // Size class + 1 of each chunk, or 0 while it isn't committed.
+    XUINT8 s_chunkSizeClasses[c_chunkCount] = {};
+
+    // Chunks below s_usedChunkCount that were decommitted by a trim, to be committed again first.
+    XUINT32 s_decommittedChunks[c_chunkCount] = {};
+    size_t s_decommittedChunkCount = 0;
+
+    // Used by TrimSlabAllocator to count the free blocks of each chunk.
+    constexpr XUINT16 c_emptyChunkMarker = 0xFFFF;
+    XUINT16 s_chunkFreeBlockCounts[c_chunkCount] = {};
+    FreeBlock* s_sharedFreeLists[c_slabSizeClassCount] = {};
+    size_t s_sharedFreeCounts[c_slabSizeClassCount] = {};
+    size_t s_chunkCounts[c_slabSizeClassCount] = {};
+
+    thread_local ThreadCache t_cache;
+
+    // Objects can still be freed by other thread_local destructors after the cache is gone.
+    thread_local bool t_isCacheDestroyed = false;
+
+    size_t GetSizeClass(_In_ size_t cSize)
+    {
+        return (cSize == 0) ? 0 : (cSize - 1) / c_slabGranularity;
+    }
+
+    size_t GetBlockSize(_In_ size_t sizeClass)
+    {
+        return (sizeClass + 1) * c_slabGranularity;
+    }
+
+    size_t GetChunkIndex(_In_ const XUINT8* pBase, _In_ const void* pAddress)
+    {
+        return (static_cast<const XUINT8*>(pAddress) - pBase) / c_chunkSize;
+    }
+
+    // Returns the size class of the block, or -1 if the address isn't in a slab.
+    size_t FindSizeClass(_In_opt_ const void *pAddress)
+    {
+        const XUINT8* pBase = s_pBase.load(std::memory_order_acquire);
+        const uintptr_t offset = reinterpret_cast<uintptr_t>(pAddress) - reinterpret_cast<uintptr_t>(pBase);
+
+        if (pBase == nullptr || offset >= c_reservationSize)
+        {
+            return static_cast<size_t>(-1);
+        }
+
+        const XUINT8 sizeClass = s_chunkSizeClasses[offset / c_chunkSize];
+        ASSERT(sizeClass != 0);
+
+        return sizeClass - 1;
+    }
+
+    // Takes blocks from the shared list into the list passed in, or commits a new chunk for them.
+    // Returns false once the reserved range is used up.
+    bool RefillFreeList(_In_ size_t sizeClass, _Inout_ FreeBlock** ppFreeList, _Inout_ XUINT32* pFreeCount)
+    {
+        XUINT8* pChunk = nullptr;
+
+        {
+            auto guard = wil::AcquireSRWLockExclusive(&s_lock);
+
+            if (s_sharedFreeLists[sizeClass])
+            {
+                while (s_sharedFreeLists[sizeClass] && *pFreeCount < c_refillCount)
+                {
+                    FreeBlock* pBlock = s_sharedFreeLists[sizeClass];
+                    s_sharedFreeLists[sizeClass] = pBlock->pNext;
+                    --s_sharedFreeCounts[sizeClass];
+
+                    pBlock->pNext = *ppFreeList;
+                    *ppFreeList = pBlock;
+                    ++*pFreeCount;
+                }
+
+                return true;
+            }
+
+            size_t chunkIndex = 0;
+
+            if (s_decommittedChunkCount > 0)
+            {
+                chunkIndex = s_decommittedChunks[--s_decommittedChunkCount];
+            }
+            else if (s_usedChunkCount < c_chunkCount)
+            {
+                chunkIndex = s_usedChunkCount++;
+            }
+            else
+            {
+                return false;
+            }
+
+            pChunk = s_pBase.load(std::memory_order_relaxed) + chunkIndex * c_chunkSize;
+
+            if (!VirtualAlloc(pChunk, c_chunkSize, MEM_COMMIT, PAGE_READWRITE))
+            {
+                // Terminate the process on OOM in a predictable way that gives us
+                // clear Watson data.
+                XAMLTerminateProcessOnMemoryExhaustion(c_chunkSize);
+            }
+
+            s_chunkSizeClasses[chunkIndex] = static_cast<XUINT8>(sizeClass + 1);
+            ++s_chunkCounts[sizeClass];
+        }
+
+        // The new chunk isn't visible to anyone else yet. Link its blocks so that they're handed
+        // out in address order.
+        const size_t blockSize = GetBlockSize(sizeClass);
+        const size_t blockCount = c_chunkSize / blockSize;
+
+        for (size_t i = blockCount; i-- > 0;)
+        {
+            FreeBlock* pBlock = reinterpret_cast<FreeBlock*>(pChunk + i * blockSize);
+            pBlock->pNext = *ppFreeList;
+            *ppFreeList = pBlock;
+        }
+
+        *pFreeCount += static_cast<XUINT32>(blockCount);
+
+        return true;
+    }
+
+    // Moves the first count blocks of the list to the shared list.
+    void ReleaseFreeBlocks(_In_ size_t sizeClass, _Inout_ FreeBlock** ppFreeList, _Inout_ XUINT32* pFreeCount, _In_ XUINT32 count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        FreeBlock* pFirst = *ppFreeList;
+        FreeBlock* pLast = pFirst;
+
+        for (XUINT32 i = 1; i < count; ++i)
+        {
+            pLast = pLast->pNext;
+        }
+
+        *ppFreeList = pLast->pNext;
+        *pFreeCount -= count;
+
+        auto guard = wil::AcquireSRWLockExclusive(&s_lock);
+
+        pLast->pNext = s_sharedFreeLists[sizeClass];
+        s_sharedFreeLists[sizeClass] = pFirst;
+        s_sharedFreeCounts[sizeClass] += count;
+    }
+
+    ThreadCache::~ThreadCache()
+    {
+        for (size_t sizeClass = 0; sizeClass < c_slabSizeClassCount; ++sizeClass)
+        {
+            ReleaseFreeBlocks(sizeClass, &freeLists[sizeClass], &freeCounts[sizeClass], freeCounts[sizeClass]);
+        }
+
+        t_isCacheDestroyed = true;
+    }
+}
+
+void XcpAllocation::EnableSlabAllocator()
+{
+#if !XCP_MONITOR
+    // Slab blocks aren't tracked by the leak detector, so builds that have it keep using the
+    // regular allocator.
+    auto guard = wil::AcquireSRWLockExclusive(&s_lock);
+
+    if (s_pBase.load(std::memory_order_relaxed) == nullptr)
+    {
+        XUINT8* pBase = static_cast<XUINT8*>(VirtualAlloc(nullptr, c_reservationSize, MEM_RESERVE, PAGE_READWRITE));
+
+        if (!pBase)
+        {
+            // Not being able to reserve the range only means running without slabs.
+            return;
+        }
+
+        s_pBase.store(pBase, std::memory_order_release);
+    }
+
+    s_isEnabled.store(true, std::memory_order_relaxed);
+#endif
+}
+
+bool XcpAllocation::IsSlabAllocatorEnabled()
+{
+    return s_isEnabled.load(std::memory_order_relaxed);
+}
+
+_Check_return_ void *XcpAllocation::SlabAllocate(_In_ size_t cSize)
+{
+    if (cSize <= c_maxSlabBlockSize && IsSlabAllocatorEnabled())
+    {
+        const size_t sizeClass = GetSizeClass(cSize);
+
+        if (!t_isCacheDestroyed)
+        {
+            ThreadCache& cache = t_cache;
+
+            if (cache.freeLists[sizeClass] || RefillFreeList(sizeClass, &cache.freeLists[sizeClass], &cache.freeCounts[sizeClass]))
+            {
+                FreeBlock* pBlock = cache.freeLists[sizeClass];
+                cache.freeLists[sizeClass] = pBlock->pNext;
+                --cache.freeCounts[sizeClass];
+
+                return pBlock;
+            }
+        }
+        else
+        {
+            FreeBlock* pFreeList = nullptr;
+            XUINT32 freeCount = 0;
+
+            if (RefillFreeList(sizeClass, &pFreeList, &freeCount))
+            {
+                FreeBlock* pBlock = pFreeList;
+                pFreeList = pBlock->pNext;
+                --freeCount;
+
+                ReleaseFreeBlocks(sizeClass, &pFreeList, &freeCount, freeCount);
+
+                return pBlock;
+            }
+        }
+
+        // The reserved range is used up, fall back to the heap.
+    }
+
+    return ::operator new(cSize);
+}
+
+void XcpAllocation::SlabFree(_Frees_ptr_opt_ void *pAddress)
+{
+    if (!pAddress)
+    {
+        return;
+    }
+
+    const size_t sizeClass = FindSizeClass(pAddress);
+
+    if (sizeClass == static_cast<size_t>(-1))
+    {
+        ::operator delete(pAddress);
+        return;
+    }
+
+    FreeBlock* pBlock = static_cast<FreeBlock*>(pAddress);
+
+    if (!t_isCacheDestroyed)
+    {
+        ThreadCache& cache = t_cache;
+
+        pBlock->pNext = cache.freeLists[sizeClass];
+        cache.freeLists[sizeClass] = pBlock;
+
+        if (++cache.freeCounts[sizeClass] > c_maxThreadFreeCount)
+        {
+            ReleaseFreeBlocks(sizeClass, &cache.freeLists[sizeClass], &cache.freeCounts[sizeClass], c_maxThreadFreeCount / 2);
+        }
+    }
+    else
+    {
+        auto guard = wil::AcquireSRWLockExclusive(&s_lock);
+
+        pBlock->pNext = s_sharedFreeLists[sizeClass];
+        s_sharedFreeLists[sizeClass] = pBlock;
+        ++s_sharedFreeCounts[sizeClass];
+    }
+}
+
+void XcpAllocation::TrimSlabAllocator()
+{
+    XUINT8* pBase = s_pBase.load(std::memory_order_acquire);
+
+    if (pBase == nullptr)
+    {
+        return;
+    }
+
+    // Hand this thread's free blocks to the shared lists, so that the chunks they're in can be
+    // found empty too.
+    if (!t_isCacheDestroyed)
+    {
+        ThreadCache& cache = t_cache;
+
+        for (size_t sizeClass = 0; sizeClass < c_slabSizeClassCount; ++sizeClass)
+        {
+            ReleaseFreeBlocks(sizeClass, &cache.freeLists[sizeClass], &cache.freeCounts[sizeClass], cache.freeCounts[sizeClass]);
+        }
+    }
+
+    auto guard = wil::AcquireSRWLockExclusive(&s_lock);
+
+    // A chunk holds no objects when all of its blocks are in the shared lists.
+    std::fill_n(s_chunkFreeBlockCounts, s_usedChunkCount, static_cast<XUINT16>(0));
+
+    for (size_t sizeClass = 0; sizeClass < c_slabSizeClassCount; ++sizeClass)
+    {
+        for (FreeBlock* pBlock = s_sharedFreeLists[sizeClass]; pBlock != nullptr; pBlock = pBlock->pNext)
+        {
+            ++s_chunkFreeBlockCounts[GetChunkIndex(pBase, pBlock)];
+        }
+    }
+
+    bool hasEmptyChunks = false;
+
+    for (size_t chunkIndex = 0; chunkIndex < s_usedChunkCount; ++chunkIndex)
+    {
+        const XUINT8 sizeClass = s_chunkSizeClasses[chunkIndex];
+
+        if (sizeClass != 0 && s_chunkFreeBlockCounts[chunkIndex] == c_chunkSize / GetBlockSize(sizeClass - 1))
+        {
+            s_chunkFreeBlockCounts[chunkIndex] = c_emptyChunkMarker;
+            hasEmptyChunks = true;
+        }
+    }
+
+    if (!hasEmptyChunks)
+    {
+        return;
+    }
+
+    // Unlink the blocks of the empty chunks before their memory goes away.
+    for (size_t sizeClass = 0; sizeClass < c_slabSizeClassCount; ++sizeClass)
+    {
+        FreeBlock** ppLink = &s_sharedFreeLists[sizeClass];
+
+        while (*ppLink != nullptr)
+        {
+            if (s_chunkFreeBlockCounts[GetChunkIndex(pBase, *ppLink)] == c_emptyChunkMarker)
+            {
+                *ppLink = (*ppLink)->pNext;
+                --s_sharedFreeCounts[sizeClass];
+            }
+            else
+            {
+                ppLink = &(*ppLink)->pNext;
+            }
+        }
+    }
+
+    for (size_t chunkIndex = 0; chunkIndex < s_usedChunkCount; ++chunkIndex)
+    {
+        if (s_chunkFreeBlockCounts[chunkIndex] == c_emptyChunkMarker)
+        {
+            VERIFY(VirtualFree(pBase + chunkIndex * c_chunkSize, c_chunkSize, MEM_DECOMMIT));
+
+            --s_chunkCounts[s_chunkSizeClasses[chunkIndex] - 1];
+            s_chunkSizeClasses[chunkIndex] = 0;
+            s_decommittedChunks[s_decommittedChunkCount++] = static_cast<XUINT32>(chunkIndex);
+        }
+    }
+}
+
+size_t XcpAllocation::GetSlabBlockSize(_In_opt_ const void *pAddress)
+{
+    const size_t sizeClass = FindSizeClass(pAddress);
+    return (sizeClass == static_cast<size_t>(-1)) ? 0 : GetBlockSize(sizeClass);
+}
+
+void XcpAllocation::GetSlabStatistics(_Out_writes_(c_slabSizeClassCount) SlabSizeClassStatistics *pStatistics)
+{
+    auto guard = wil::AcquireSRWLockShared(&s_lock);
+
+    for (size_t sizeClass = 0; sizeClass < c_slabSizeClassCount; ++sizeClass)
+    {
+        pStatistics[sizeClass].BlockSize = GetBlockSize(sizeClass);
+        pStatistics[sizeClass].ChunkCount = s_chunkCounts[sizeClass];
+        pStatistics[sizeClass].SharedFreeCount = s_sharedFreeCounts[sizeClass];
+    }
+}
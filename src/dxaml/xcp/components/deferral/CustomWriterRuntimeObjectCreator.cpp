@@ -61,6 +61,85 @@ CustomWriterRuntimeObjectCreator::CreateInstance(
     IFC_RETURN(EnsureObjectWriter());
     m_pendingFirstNode = true;
     IFC_RETURN(RunObjectWriter(token, nullptr, std::vector<StreamOffsetToken>()));
+    GetResult(pResult, resultAsThemeResource);
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT
+CustomWriterRuntimeObjectCreator::DecodeNodes(
+    _In_ StreamOffsetToken token,
+    _Out_ std::vector<ObjectWriterNode>* pNodes)
+{
+    pNodes->clear();
+
+    auto reader = GetReaderAndSetIndex(token.GetIndex());
+
+    // The nodes outlive the next read, so they need their own constants.
+    reader->set_ReuseConstantValue(false);
+    auto resetReaderGuard = wil::scope_exit([&]()
+    {
+        reader->set_ReuseConstantValue(true);
+        RestoreReaderIndex();
+    });
+
+    int streamDepth = 0;
+    ObjectWriterNode node;
+
+    do
+    {
+        VERIFY(reader->TryRead(node));
+
+        if (node.RequiresNewScope())
+        {
+            streamDepth++;
+        }
+        else if (node.RequiresScopeToEnd())
+        {
+            streamDepth--;
+        }
+
+        // These carry a reader for their content, which the ObjectWriter moves through.
+        if (node.GetNodeType() == ObjectWriterNodeType::SetDeferredProperty ||
+            node.GetNodeType() == ObjectWriterNodeType::SetCustomRuntimeData)
+        {
+            pNodes->clear();
+            return S_OK;
+        }
+
+        pNodes->push_back(std::move(node));
+    }
+    while (streamDepth != 0);
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT
+CustomWriterRuntimeObjectCreator::CreateInstance(
+    _In_ const std::vector<ObjectWriterNode>& nodes,
+    _Out_ std::shared_ptr<CDependencyObject>* pResult,
+    _Out_ xref_ptr<CThemeResource>* resultAsThemeResource)
+{
+    // Initialize the output parameters to a valid state
+    *pResult = nullptr;
+    *resultAsThemeResource = nullptr;
+
+    IFC_RETURN(EnsureObjectWriter());
+
+    for (const auto& node : nodes)
+    {
+        IFC_RETURN(m_writer->WriteNode(node));
+    }
+
+    GetResult(pResult, resultAsThemeResource);
+
+    return S_OK;
+}
+
+void CustomWriterRuntimeObjectCreator::GetResult(
+    _Out_ std::shared_ptr<CDependencyObject>* pResult,
+    _Out_ xref_ptr<CThemeResource>* resultAsThemeResource)
+{
     std::shared_ptr<XamlQualifiedObject> result = m_writer->get_Result();
     ASSERT(result);
 
@@ -73,8 +152,6 @@ CustomWriterRuntimeObjectCreator::CreateInstance(
         // Return DependencyObject with ownership back to the caller.
         *pResult = result->GetAndTransferDependencyObjectOwnership();
     }
-
-    return S_OK;
 }
 
 _Check_return_ HRESULT CustomWriterRuntimeObjectCreator::ApplyStreamToExistingInstance(
@@ -222,6 +222,11 @@ bool VisualStateGroupCollectionCustomRuntimeData::TryGetVisualTransition(
     return false;
 }
 
+std::shared_ptr<const std::vector<ObjectWriterNode>>& VisualStateGroupCollectionCustomRuntimeData::GetDecodedNodes(_In_ StreamOffsetToken token)
+{
+    return m_decodedNodes[token];
+}
+
 bool VisualStateGroupCollectionCustomRuntimeData::ShouldBailOut() const
 {
     return m_unexpectedTokensDetected;
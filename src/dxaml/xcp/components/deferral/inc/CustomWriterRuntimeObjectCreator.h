@@ -72,6 +72,18 @@ public:
         _Out_ std::shared_ptr<CDependencyObject>* pInstance,
         _Out_ xref_ptr<CThemeResource>* resultAsThemeResource);
 
+    // Reads the nodes of the object at the token, so that more instances of it can be created from
+    // them without reading the stream again. Leaves pNodes empty if the object has deferred content,
+    // whose nodes can only be written once.
+    _Check_return_ HRESULT DecodeNodes(
+        _In_ StreamOffsetToken token,
+        _Out_ std::vector<ObjectWriterNode>* pNodes);
+
+    _Check_return_ HRESULT CreateInstance(
+        _In_ const std::vector<ObjectWriterNode>& nodes,
+        _Out_ std::shared_ptr<CDependencyObject>* pInstance,
+        _Out_ xref_ptr<CThemeResource>* resultAsThemeResource);
+
     // When we create an entry with NameScopeRegistrationMode::SkipRegistration they are
     // by excluded from TemplateNameScope registration. For cases where we're
     // only instantiating small parts of a larger element tree for specific
@@ -98,6 +110,10 @@ private:
         _In_opt_ CDependencyObject* instance, 
         _In_ const std::vector<StreamOffsetToken>& indexRangesToSkip);
 
+    void GetResult(
+        _Out_ std::shared_ptr<CDependencyObject>* pInstance,
+        _Out_ xref_ptr<CThemeResource>* resultAsThemeResource);
+
     _Check_return_ HRESULT EnsureObjectWriter();
     std::shared_ptr<XamlSavedContext> BuildSavedContext();
     _Check_return_ HRESULT BuildObjectWriterSettings(_Out_ ObjectWriterSettings* pResult);
@@ -8,8 +8,10 @@
 
 #include <xstring_ptr.h>
 #include <vector>
+#include <vector_map.h>
 #include <cstdint>
 
+class ObjectWriterNode;
 class VisualStateGroupCollectionCustomWriter;
 class VisualTransitionTableOptimizedLookup;
 enum class CustomWriterRuntimeDataTypeIndex : std::uint16_t;
@@ -192,6 +194,11 @@ public:
 
     const std::vector<xstring_ptr>& GetSeenNames() const;
 
+    // Storyboards and VisualTransitions are created for every control that goes to their state.
+    // This data is shared by all the controls created from the same XBF, so their nodes are decoded
+    // once here and the controls only create and target their own instances. Empty until decoded.
+    std::shared_ptr<const std::vector<ObjectWriterNode>>& GetDecodedNodes(_In_ StreamOffsetToken token);
+
     // Test hooks
     std::vector<std::wstring> GetVisualStateNamesForGroup(_In_ unsigned int groupIndex) const;
     std::vector<std::wstring> GetVisualStateGroupNames() const;
@@ -219,6 +226,8 @@ private:
     // and to avoid making VTTOL part of the public includes for the Deferral
     // component.
     std::unique_ptr<VisualTransitionTableOptimizedLookup> m_visualTransitionLookup;
+
+    containers::vector_map<StreamOffsetToken, std::shared_ptr<const std::vector<ObjectWriterNode>>> m_decodedNodes;
 };
 
 
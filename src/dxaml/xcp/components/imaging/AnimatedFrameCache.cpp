@@ -0,0 +1,155 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include <wincodec.h>
+#include "AnimatedFrameCache.h"
+#include "XamlTelemetry.h"
+#include <algorithm>
+#include <iterator>
+
+std::atomic<uint64_t> AnimatedFrameCache::s_totalBytes = 0;
+std::mutex AnimatedFrameCache::s_cachesMutex;
+std::vector<AnimatedFrameCache*> AnimatedFrameCache::s_caches;
+
+AnimatedFrameCache::AnimatedFrameCache()
+{
+    std::lock_guard<std::mutex> lock(s_cachesMutex);
+    s_caches.push_back(this);
+}
+
+AnimatedFrameCache::~AnimatedFrameCache()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_cachesMutex);
+        s_caches.erase(std::find(s_caches.begin(), s_caches.end(), this));
+    }
+
+    s_totalBytes -= m_bytes;
+}
+
+bool AnimatedFrameCache::TryGetFrame(
+    int frameIndex,
+    _Out_ WicAnimatedGifDecoder::DeltaFrameInfo& deltaFrameInfo,
+    _Out_ wrl::ComPtr<IWICBitmap>& spDeltaFrameBitmap
+    )
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (frameIndex < static_cast<int>(m_frames.size()) && m_frames[frameIndex].Bitmap != nullptr)
+    {
+        deltaFrameInfo = m_frames[frameIndex].Info;
+        spDeltaFrameBitmap = m_frames[frameIndex].Bitmap;
+        ++m_hitCount;
+        return true;
+    }
+
+    deltaFrameInfo = {};
+    spDeltaFrameBitmap.Reset();
+    ++m_missCount;
+    return false;
+}
+
+void AnimatedFrameCache::AddFrame(
+    int frameIndex,
+    _In_ const WicAnimatedGifDecoder::DeltaFrameInfo& deltaFrameInfo,
+    _In_ const wrl::ComPtr<IWICBitmap>& spDeltaFrameBitmap
+    )
+{
+    ASSERT(frameIndex >= 0);
+
+    UINT width = 0;
+    UINT height = 0;
+
+    if (FAILED(spDeltaFrameBitmap->GetSize(&width, &height)))
+    {
+        return;
+    }
+
+    // Delta frames are always 32bpp PBGRA.
+    const uint64_t bytes = static_cast<uint64_t>(width) * height * 4;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Another decoder showing the same image may have added it already.
+    if (frameIndex < static_cast<int>(m_frames.size()) && m_frames[frameIndex].Bitmap != nullptr)
+    {
+        return;
+    }
+
+    if (m_bytes + bytes > c_maxBytesPerImage)
+    {
+        return;
+    }
+
+    if (s_totalBytes.fetch_add(bytes) + bytes > c_maxTotalBytes)
+    {
+        s_totalBytes -= bytes;
+        return;
+    }
+
+    if (frameIndex >= static_cast<int>(m_frames.size()))
+    {
+        m_frames.resize(frameIndex + 1);
+    }
+
+    m_frames[frameIndex] = { deltaFrameInfo, spDeltaFrameBitmap };
+    m_bytes += bytes;
+    ++m_frameCount;
+}
+
+AnimatedFrameCache::Statistics AnimatedFrameCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Statistics statistics = {};
+
+    statistics.FrameCount = m_frameCount;
+    statistics.HitCount = m_hitCount;
+    statistics.MissCount = m_missCount;
+    statistics.TrimCount = m_trimCount;
+    statistics.ByteCount = m_bytes;
+
+    return statistics;
+}
+
+/* static */ void AnimatedFrameCache::TrimAll()
+{
+    std::vector<Frame> trimmedFrames;
+    uint64_t trimmedBytes = 0;
+    XUINT32 trimmedCacheCount = 0;
+
+    {
+        std::lock_guard<std::mutex> cachesLock(s_cachesMutex);
+
+        for (AnimatedFrameCache* pCache : s_caches)
+        {
+            std::lock_guard<std::mutex> lock(pCache->m_mutex);
+
+            if (pCache->m_bytes == 0)
+            {
+                continue;
+            }
+
+            // Decoders that already took a frame keep their own reference to its bitmap.
+            std::move(pCache->m_frames.begin(), pCache->m_frames.end(), std::back_inserter(trimmedFrames));
+            pCache->m_frames.clear();
+
+            s_totalBytes -= pCache->m_bytes;
+            trimmedBytes += pCache->m_bytes;
+            pCache->m_bytes = 0;
+
+            ++pCache->m_trimCount;
+            ++trimmedCacheCount;
+        }
+    }
+
+    // The bitmaps are released here, outside of the locks.
+    trimmedFrames.clear();
+
+    TraceLoggingProviderWrite(
+        XamlTelemetry, "Imaging_AnimatedFrameCacheTrimmed",
+        TraceLoggingUInt32(trimmedCacheCount, "ImageCount"),
+        TraceLoggingUInt64(trimmedBytes, "ByteCount"),
+        TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+}
@@ -15,6 +15,8 @@
 #include "ImageMetadata.h"
 #include "WicService.h"
 #include "EncodedImageData.h"
+#include "AnimatedFrameCache.h"
+#include <RuntimeEnabledFeatures.h>
 
 bool EncodedImageData::s_testHook_ForceDeviceLostOnMetadataParse = false;
 
@@ -264,6 +266,25 @@ bool EncodedImageData::IsAnimatedImage() const
     return GetMetadata().frameCount > 1;
 }
 
+_Ret_maybenull_ AnimatedFrameCache* EncodedImageData::GetAnimatedFrameCache()
+{
+    if (!IsAnimatedImage() ||
+        !RuntimeFeatureBehavior::GetRuntimeEnabledFeatureDetector()->IsFeatureEnabled(
+            RuntimeFeatureBehavior::RuntimeEnabledFeature::CacheAnimatedImageFrames))
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_animatedFrameCache)
+    {
+        m_animatedFrameCache = std::make_unique<AnimatedFrameCache>();
+    }
+
+    return m_animatedFrameCache.get();
+}
+
 _Check_return_ HRESULT EncodedImageData::CreateIStream(_Out_ wrl::ComPtr<IStream>& spIStream)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -22,6 +22,12 @@
 #include <Mferror.h>
 #include "TinyRGB.h"
 
+#if defined(_X86_) || defined(_AMD64_)
+#include <emmintrin.h>
+#elif defined(_ARM_) || defined(_ARM64_)
+#include <arm_neon.h>
+#endif
+
 using namespace DirectUI;
 
 template<typename T>
@@ -79,6 +85,78 @@ static _Check_return_ HRESULT IsKnownSRGBProfile(
     return S_OK;
 }
 
+// SSE2 is always there on the x86 and amd64 processors we run on, and NEON on ARM, so there's no need to check at runtime.
+static void FillPixels(
+    _Out_writes_(count) uint32_t* pDst,
+    uint32_t count,
+    uint32_t color
+    )
+{
+    uint32_t x = 0;
+
+#if defined(_X86_) || defined(_AMD64_)
+    const __m128i color4 = _mm_set1_epi32(static_cast<int>(color));
+
+    for (; x + 4 <= count; x += 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x), color4);
+    }
+#elif defined(_ARM_) || defined(_ARM64_)
+    const uint32x4_t color4 = vdupq_n_u32(color);
+
+    for (; x + 4 <= count; x += 4)
+    {
+        vst1q_u32(pDst + x, color4);
+    }
+#endif
+
+    for (; x < count; x++)
+    {
+        pDst[x] = color;
+    }
+}
+
+// Copies the opaque pixels of a GIF frame row over the destination row, see GifBltPBGRANoBlend.
+static void GifBlendRow(
+    _In_reads_(count) const uint32_t* pSrc,
+    _Inout_updates_(count) uint32_t* pDst,
+    uint32_t count
+    )
+{
+    uint32_t x = 0;
+
+#if defined(_X86_) || defined(_AMD64_)
+    for (; x + 4 <= count; x += 4)
+    {
+        const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x));
+        const __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pDst + x));
+        const __m128i mask = _mm_srai_epi32(src, 24);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x), _mm_or_si128(src, _mm_andnot_si128(mask, dst)));
+    }
+#elif defined(_ARM_) || defined(_ARM64_)
+    for (; x + 4 <= count; x += 4)
+    {
+        const uint32x4_t src = vld1q_u32(pSrc + x);
+        const uint32x4_t dst = vld1q_u32(pDst + x);
+        const uint32x4_t mask = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(src), 24));
+
+        vst1q_u32(pDst + x, vorrq_u32(src, vbicq_u32(dst, mask)));
+    }
+#endif
+
+    for (; x < count; x++)
+    {
+        // Note that signed shift has an implementation defined behavior.
+        // Visual C++ compiler performs the sign extension which is what want.
+        int32_t mask = static_cast<int32_t>(pSrc[x]) >> 24;
+
+        // The mask is 0x00000000 for transparent source and is 0xffffffff for opaque source.
+        // No need to mask the source as it already comes pre-multiplied with alpha.
+        pDst[x] = pSrc[x] | pDst[x] & ~mask;
+    }
+}
+
 _Check_return_ HRESULT ImagingUtility::ClearBitmap(
     _In_ wrl::ComPtr<IWICBitmap>& spBitmap,
     _In_ const WICRect& rect,
@@ -101,9 +179,9 @@ _Check_return_ HRESULT ImagingUtility::ClearBitmap(
     {
         uint32_t* pBufferLineInPixels = reinterpret_cast<uint32_t*>(pBufferLine);
 
-        for (auto x = left; x < right; x++)
+        if (right > left)
         {
-            pBufferLineInPixels[x] = color;
+            FillPixels(pBufferLineInPixels + left, static_cast<uint32_t>(right - left), color);
         }
 
         pBufferLine += wicBitmapLock.GetStride();
@@ -141,19 +219,7 @@ _Check_return_ HRESULT ImagingUtility::GifBltPBGRANoBlend(
         auto src = reinterpret_cast<const uint32_t*>(srcFrameLock.GetBuffer() + y * srcFrameLock.GetStride());
         auto dst = reinterpret_cast<uint32_t*>(dstBitmapLock.GetBuffer() + y * dstBitmapLock.GetStride());
 
-        for (uint32_t x = 0; x < srcFrameLock.GetWidth(); x++)
-        {
-            // Note that signed shift has an implementation defined behavior.
-            // Visual C++ compiler performs the sign extension which is what want.
-            int32_t mask = static_cast<int32_t>(*src) >> 24;
-
-            // The mask is 0x00000000 for transparent source and is 0xffffffff for opaque source.
-            // No need to mask the source as it already comes pre-multiplied with alpha.
-            *dst = *src | *dst & ~mask;
-
-            dst++;
-            src++;
-        }
+        GifBlendRow(src, dst, srcFrameLock.GetWidth());
     }
 
     return S_OK;
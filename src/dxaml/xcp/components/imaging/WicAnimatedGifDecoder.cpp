@@ -22,6 +22,7 @@
 #include "WicBitmapLock.h"
 #include "WicService.h"
 #include "WicAnimatedGifDecoder.h"
+#include "AnimatedFrameCache.h"
 #include "DoubleUtil.h"
 
 // OPTIMIZE: Potential memory and performance optimization
@@ -79,6 +80,8 @@ _Check_return_ HRESULT WicAnimatedGifDecoder::DecodeFrame(
         m_currentFrameIndex = -1;
     }
 
+    AnimatedFrameCache* pFrameCache = encodedImageData.GetAnimatedFrameCache();
+
     while (m_currentFrameIndex != frameIndex)
     {
         // Loop handling is done by the caller of this function.
@@ -89,9 +92,6 @@ _Check_return_ HRESULT WicAnimatedGifDecoder::DecodeFrame(
             m_currentDeltaFrameInfo.bounds = WICRect{ 0, 0, (INT)imageMetadata.width, (INT)imageMetadata.height };
         }
 
-        wrl::ComPtr<IWICBitmapDecoder> spBitmapDecoder;
-        IFC_RETURN(encodedImageData.CreateWicBitmapDecoder(spBitmapDecoder));
-
         // TODO: All wic operations should be mutexed through the service and never provide direct
         //                 access to the factory.
         auto spWicFactory = WicService::GetInstance().GetFactory();
@@ -129,8 +129,32 @@ _Check_return_ HRESULT WicAnimatedGifDecoder::DecodeFrame(
             break;
         }
 
-        wrl::ComPtr<IWICBitmapSource> spDeltaFrameSource;
-        IFC_RETURN(CreateDeltaFrameSource(spBitmapDecoder, m_currentFrameIndex, m_currentDeltaFrameInfo, spDeltaFrameSource));
+        // Decode into a temporary SoftwareBitmap buffer.  This could be done by decoding
+        // in-place into the composition bitmap.  However, the composition surface bits are shared outside
+        // for software rasterization purposes and creating a read lock on the buffer for a long period of time
+        // while decoding could cause a major performance issue on the UI thread.  The surface is also
+        // shared to save memory by not creating extra copies when they are not explicitly needed.
+        //
+        // The delta frame may already have been decoded by an earlier loop, or by another element showing this image.
+        wrl::ComPtr<IWICBitmap> spDeltaFrameBitmap;
+        if (pFrameCache == nullptr || !pFrameCache->TryGetFrame(m_currentFrameIndex, m_currentDeltaFrameInfo, spDeltaFrameBitmap))
+        {
+            wrl::ComPtr<IWICBitmapDecoder> spBitmapDecoder;
+            IFC_RETURN(encodedImageData.CreateWicBitmapDecoder(spBitmapDecoder));
+
+            wrl::ComPtr<IWICBitmapSource> spDeltaFrameSource;
+            IFC_RETURN(CreateDeltaFrameSource(spBitmapDecoder, m_currentFrameIndex, m_currentDeltaFrameInfo, spDeltaFrameSource));
+
+            IFC_RETURN(spWicFactory->CreateBitmapFromSource(
+                spDeltaFrameSource.Get(),
+                WICBitmapCreateCacheOption::WICBitmapCacheOnLoad,
+                &spDeltaFrameBitmap));
+
+            if (pFrameCache != nullptr)
+            {
+                pFrameCache->AddFrame(m_currentFrameIndex, m_currentDeltaFrameInfo, spDeltaFrameBitmap);
+            }
+        }
 
         // Make a copy of the current bitmap to restore it later when disposing the current delta frame
         if (m_currentDeltaFrameInfo.disposalMethod == DisposalMethod::Previous)
@@ -145,17 +169,6 @@ _Check_return_ HRESULT WicAnimatedGifDecoder::DecodeFrame(
             IFC_RETURN(ImagingUtility::BltBGRA(nullptr, m_spCurrentBitmap, nullptr, m_spSavedBitmap));
         }
 
-        // Decode into a temporary SoftwareBitmap buffer.  This could be done by decoding
-        // in-place into the composition bitmap.  However, the composition surface bits are shared outside
-        // for software rasterization purposes and creating a read lock on the buffer for a long period of time
-        // while decoding could cause a major performance issue on the UI thread.  The surface is also
-        // shared to save memory by not creating extra copies when they are not explicitly needed.
-        wrl::ComPtr<IWICBitmap> spDeltaFrameBitmap;
-        IFC_RETURN(spWicFactory->CreateBitmapFromSource(
-            spDeltaFrameSource.Get(),
-            WICBitmapCreateCacheOption::WICBitmapCacheOnLoad,
-            &spDeltaFrameBitmap));
-
         WICRect srcRect;
         ClipForBlt(imageMetadata.width, imageMetadata.height, m_currentDeltaFrameInfo.bounds, srcRect);
 
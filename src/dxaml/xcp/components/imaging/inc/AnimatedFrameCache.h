@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "WicAnimatedGifDecoder.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Keeps the decoded delta frames of an animated image, so playing it again, or showing it in several elements at once,
+// doesn't decode the same frames over and over. A GIF frame only covers the part of the image that changed since the
+// previous one, so that's all that's kept: the frame's pixels within its bounds, and the bounds, delay and disposal
+// method needed to compose it. Each WicAnimatedGifDecoder still composes its own frames from these.
+//
+// The cached bitmaps are never written after they're added, and WIC lets any number of readers lock a bitmap at once,
+// so decoders on different threads can share them. Once an image or the process is over its budget, new frames
+// are decoded as usual but not kept. When the app is low on memory, TrimAll drops the frames of every image.
+class AnimatedFrameCache
+{
+public:
+    struct Statistics
+    {
+        XUINT32 FrameCount;
+        XUINT32 HitCount;
+        XUINT32 MissCount;
+        XUINT32 TrimCount;
+        XUINT64 ByteCount;
+    };
+
+    AnimatedFrameCache();
+    ~AnimatedFrameCache();
+
+    bool TryGetFrame(
+        int frameIndex,
+        _Out_ WicAnimatedGifDecoder::DeltaFrameInfo& deltaFrameInfo,
+        _Out_ wrl::ComPtr<IWICBitmap>& spDeltaFrameBitmap
+        );
+
+    void AddFrame(
+        int frameIndex,
+        _In_ const WicAnimatedGifDecoder::DeltaFrameInfo& deltaFrameInfo,
+        _In_ const wrl::ComPtr<IWICBitmap>& spDeltaFrameBitmap
+        );
+
+    Statistics GetStatistics();
+
+    // Releases the cached frames of all images.
+    static void TrimAll();
+
+private:
+    struct Frame
+    {
+        WicAnimatedGifDecoder::DeltaFrameInfo Info;
+        wrl::ComPtr<IWICBitmap> Bitmap;
+    };
+
+    static constexpr uint64_t c_maxBytesPerImage = 16 * 1024 * 1024;
+    static constexpr uint64_t c_maxTotalBytes = 64 * 1024 * 1024;
+
+    // Bytes held by the frame caches of all images.
+    static std::atomic<uint64_t> s_totalBytes;
+
+    // The frame caches of all images, for TrimAll. Taken before any cache's m_mutex.
+    static std::mutex s_cachesMutex;
+    static std::vector<AnimatedFrameCache*> s_caches;
+
+    std::mutex m_mutex;
+    std::vector<Frame> m_frames;
+    uint64_t m_bytes = 0;
+    XUINT32 m_frameCount = 0;
+    XUINT32 m_hitCount = 0;
+    XUINT32 m_missCount = 0;
+    XUINT32 m_trimCount = 0;
+};
@@ -6,6 +6,7 @@
 #include "ImageMetadata.h"
 #include <mutex>
 
+class AnimatedFrameCache;
 class CWindowRenderTarget;
 class CD3D11Device;
 class IRawData;
@@ -42,6 +43,9 @@ public:
         );
     bool IsAnimatedImage() const;
 
+    // Decoded frames shared by everything playing this image, or null if frames aren't being cached.
+    _Ret_maybenull_ AnimatedFrameCache* GetAnimatedFrameCache();
+
     bool IsMetadataAvailable() const { return m_isParsed; }
 
     _Check_return_ HRESULT CreateIStream(_Out_ wrl::ComPtr<IStream>& spIStream);
@@ -73,6 +77,7 @@ private:
     bool m_isParsed = false;
     ImageMetadata m_imageMetadata = {};
     wrl::ComPtr<IWICBitmapDecoder> m_spWicBitmapDecoder;
+    std::unique_ptr<AnimatedFrameCache> m_animatedFrameCache;
 
     // Must guard this with a mutex because multiple decoding thread could use this encoded image
     // to decode multiple sizes.
@@ -5,6 +5,8 @@
 
 #include "WinReader.h"
 #include <ReaderString.h>
+#include <deque>
+#include <wil\resource.h>
 
 namespace XmlReaderWrapper {
     std::unique_ptr<CWinReader> CreateLegacyXmlReaderWrapper()
@@ -20,13 +22,395 @@ namespace XmlReaderWrapper {
     }
 }
 
+// Reads the whole document with XmlLite on a thread pool thread, and hands the nodes over in
+// batches. An element is always in the same batch as its attributes, so the attributes can be
+// walked (more than once) while positioned on it.
+class CWinReader::PipelinedNodeSource
+{
+public:
+    explicit PipelinedNodeSource(xref_ptr<IXmlReader> reader)
+        : m_reader(std::move(reader))
+    {}
+
+    ~PipelinedNodeSource()
+    {
+        {
+            auto lock = wil::AcquireSRWLockExclusive(&m_lock);
+            m_isCanceled = true;
+        }
+
+        WakeAllConditionVariable(&m_batchTaken);
+
+        // Waits for the worker if it's running.
+        m_work.reset();
+    }
+
+    // Returns false if there's no thread pool work to read on.
+    bool TryStart()
+    {
+        m_work.reset(CreateThreadpoolWork(WorkCallback, this, nullptr));
+
+        if (!m_work)
+        {
+            return false;
+        }
+
+        SubmitThreadpoolWork(m_work.get());
+
+        return true;
+    }
+
+    _Check_return_ HRESULT Read(_Out_ XmlNodeType *pType)
+    {
+        *pType = XmlNodeType_None;
+
+        if (m_currentBatch)
+        {
+            const RecordedNode& current = m_currentBatch->nodes[m_currentElement];
+
+            if (current.hr != S_OK)
+            {
+                // Stay at the end of the document, or at the error.
+                return current.hr;
+            }
+
+            m_currentElement += 1 + current.attributeCount;
+        }
+
+        if (!m_currentBatch || m_currentElement == m_currentBatch->nodes.size())
+        {
+            m_currentBatch = TakeBatch();
+            m_currentElement = 0;
+        }
+
+        m_current = m_currentElement;
+
+        const RecordedNode& node = m_currentBatch->nodes[m_current];
+
+        if (node.hr == S_OK)
+        {
+            *pType = node.type;
+        }
+
+        return node.hr;
+    }
+
+    void GetPrefix(_Inout_ ReaderString *pReaderString)
+    {
+        SetString(GetCurrentNode().prefix, pReaderString);
+    }
+
+    void GetNamespaceUri(_Inout_ ReaderString *pReaderString)
+    {
+        SetString(GetCurrentNode().namespaceUri, pReaderString);
+    }
+
+    void GetLocalName(_Inout_ ReaderString *pReaderString)
+    {
+        SetString(GetCurrentNode().localName, pReaderString);
+    }
+
+    void GetValue(_Inout_ ReaderString *pReaderString)
+    {
+        SetString(GetCurrentNode().value, pReaderString);
+    }
+
+    bool EmptyElement()
+    {
+        return m_currentBatch && m_currentBatch->nodes[m_currentElement].isEmptyElement;
+    }
+
+    _Check_return_ HRESULT FirstAttribute()
+    {
+        if (!m_currentBatch || m_currentBatch->nodes[m_currentElement].attributeCount == 0)
+        {
+            return S_FALSE;
+        }
+
+        m_current = m_currentElement + 1;
+        return S_OK;
+    }
+
+    _Check_return_ HRESULT NextAttribute()
+    {
+        if (!m_currentBatch || m_current >= m_currentElement + m_currentBatch->nodes[m_currentElement].attributeCount)
+        {
+            return S_FALSE;
+        }
+
+        ++m_current;
+        return S_OK;
+    }
+
+    void GetPosition(_Out_ unsigned int *pnLine, _Out_ unsigned int *pnColumn)
+    {
+        const RecordedNode& node = GetCurrentNode();
+        *pnLine = node.line;
+        *pnColumn = node.column;
+    }
+
+private:
+    // Batches are handed over once they have this many nodes, and the worker waits while
+    // this many batches haven't been taken yet.
+    static constexpr size_t c_batchNodeCount = 512;
+    static constexpr size_t c_maxQueuedBatches = 64;
+
+    struct RecordedString
+    {
+        size_t offset;
+        unsigned int count;
+    };
+
+    struct RecordedNode
+    {
+        XmlNodeType type;
+        HRESULT hr;                     // S_FALSE at the end of the document, or the error XmlLite failed with.
+        bool isEmptyElement;
+        unsigned int attributeCount;    // The attributes of an element follow it.
+        unsigned int line;
+        unsigned int column;
+        RecordedString prefix;
+        RecordedString namespaceUri;
+        RecordedString localName;
+        RecordedString value;
+    };
+
+    struct Batch
+    {
+        std::vector<RecordedNode> nodes;
+        std::vector<wchar_t> strings;
+    };
+
+    static void CALLBACK WorkCallback(_Inout_ PTP_CALLBACK_INSTANCE, _In_ void* context, _Inout_ PTP_WORK)
+    {
+        static_cast<PipelinedNodeSource*>(context)->ReadDocument();
+    }
+
+    void ReadDocument()
+    {
+        auto batch = std::make_unique<Batch>();
+        batch->nodes.reserve(c_batchNodeCount);
+
+        for (;;)
+        {
+            XmlNodeType type = XmlNodeType_None;
+            RecordedNode node = {};
+
+            node.hr = m_reader->Read(&type);
+
+            if (node.hr != S_OK)
+            {
+                node.type = XmlNodeType_None;
+                RecordPosition(&node);
+                batch->nodes.push_back(node);
+                Publish(std::move(batch));
+                return;
+            }
+
+            node.type = type;
+
+            if (FAILED(RecordNode(batch.get(), &node)))
+            {
+                Publish(std::move(batch));
+                return;
+            }
+
+            if (type == XmlNodeType_Element)
+            {
+                const size_t elementIndex = batch->nodes.size();
+                batch->nodes.push_back(node);
+
+                HRESULT hr = m_reader->MoveToFirstAttribute();
+
+                while (hr == S_OK)
+                {
+                    RecordedNode attribute = {};
+                    attribute.type = XmlNodeType_Attribute;
+
+                    if (FAILED(RecordNode(batch.get(), &attribute)))
+                    {
+                        Publish(std::move(batch));
+                        return;
+                    }
+
+                    batch->nodes.push_back(attribute);
+                    ++batch->nodes[elementIndex].attributeCount;
+
+                    hr = m_reader->MoveToNextAttribute();
+                }
+            }
+            else
+            {
+                batch->nodes.push_back(node);
+            }
+
+            if (batch->nodes.size() >= c_batchNodeCount)
+            {
+                if (!Publish(std::move(batch)))
+                {
+                    return;
+                }
+
+                batch = std::make_unique<Batch>();
+                batch->nodes.reserve(c_batchNodeCount);
+            }
+        }
+    }
+
+    // Copies what the reader is positioned on. If a string can't be read, the node becomes the
+    // terminal node with that error, like the failure the caller would have seen.
+    _Check_return_ HRESULT RecordNode(_In_ Batch* batch, _Inout_ RecordedNode* node)
+    {
+        HRESULT hr = S_OK;
+
+        if (node->type == XmlNodeType_Element)
+        {
+            node->isEmptyElement = !!m_reader->IsEmptyElement();
+        }
+
+        RecordPosition(node);
+
+        if (SUCCEEDED(hr)) { hr = RecordString(batch, &IXmlReader::GetPrefix, &node->prefix); }
+        if (SUCCEEDED(hr)) { hr = RecordString(batch, &IXmlReader::GetNamespaceUri, &node->namespaceUri); }
+        if (SUCCEEDED(hr)) { hr = RecordString(batch, &IXmlReader::GetLocalName, &node->localName); }
+        if (SUCCEEDED(hr)) { hr = RecordString(batch, &IXmlReader::GetValue, &node->value); }
+
+        if (FAILED(hr))
+        {
+            RecordedNode failure = {};
+            failure.type = XmlNodeType_None;
+            failure.hr = hr;
+            failure.line = node->line;
+            failure.column = node->column;
+            batch->nodes.push_back(failure);
+        }
+
+        return hr;
+    }
+
+    void RecordPosition(_Inout_ RecordedNode* node)
+    {
+        IGNOREHR(m_reader->GetLineNumber(&node->line));
+        IGNOREHR(m_reader->GetLinePosition(&node->column));
+    }
+
+    _Check_return_ HRESULT RecordString(
+        _In_ Batch* batch,
+        _In_ HRESULT (STDMETHODCALLTYPE IXmlReader::*getter)(LPCWSTR*, UINT*),
+        _Out_ RecordedString* recorded)
+    {
+        const wchar_t* pString = nullptr;
+        unsigned int cString = 0;
+        IFC_RETURN((m_reader.get()->*getter)(&pString, &cString));
+
+        recorded->offset = batch->strings.size();
+        recorded->count = cString;
+
+        // Keep the terminator, callers get the same null terminated strings XmlLite gives out.
+        batch->strings.insert(batch->strings.end(), pString, pString + cString);
+        batch->strings.push_back(L'\0');
+
+        return S_OK;
+    }
+
+    // Returns false if the consumer is gone.
+    bool Publish(std::unique_ptr<Batch> batch)
+    {
+        {
+            auto lock = wil::AcquireSRWLockExclusive(&m_lock);
+
+            while (!m_isCanceled && m_batches.size() >= c_maxQueuedBatches)
+            {
+                SleepConditionVariableSRW(&m_batchTaken, &m_lock, INFINITE, 0);
+            }
+
+            if (m_isCanceled)
+            {
+                return false;
+            }
+
+            m_batches.push_back(std::move(batch));
+        }
+
+        WakeConditionVariable(&m_batchReady);
+
+        return true;
+    }
+
+    // The worker always finishes with a terminal node, so there's always another batch coming
+    // while the consumer hasn't seen it.
+    std::unique_ptr<Batch> TakeBatch()
+    {
+        std::unique_ptr<Batch> batch;
+
+        {
+            auto lock = wil::AcquireSRWLockExclusive(&m_lock);
+
+            while (m_batches.empty())
+            {
+                SleepConditionVariableSRW(&m_batchReady, &m_lock, INFINITE, 0);
+            }
+
+            batch = std::move(m_batches.front());
+            m_batches.pop_front();
+        }
+
+        WakeConditionVariable(&m_batchTaken);
+
+        return batch;
+    }
+
+    const RecordedNode& GetCurrentNode() const
+    {
+        static const RecordedNode s_noNode = {};
+        return m_currentBatch ? m_currentBatch->nodes[m_current] : s_noNode;
+    }
+
+    void SetString(const RecordedString& recorded, _Inout_ ReaderString *pReaderString) const
+    {
+        if (m_currentBatch && recorded.offset < m_currentBatch->strings.size())
+        {
+            pReaderString->SetString(recorded.count, m_currentBatch->strings.data() + recorded.offset);
+        }
+        else
+        {
+            pReaderString->SetString(0, L"");
+        }
+    }
+
+    // Only used by the worker.
+    xref_ptr<IXmlReader> m_reader;
+
+    // Shared with the worker.
+    SRWLOCK m_lock = SRWLOCK_INIT;
+    CONDITION_VARIABLE m_batchReady = CONDITION_VARIABLE_INIT;
+    CONDITION_VARIABLE m_batchTaken = CONDITION_VARIABLE_INIT;
+    std::deque<std::unique_ptr<Batch>> m_batches;
+    bool m_isCanceled = false;
+
+    wil::unique_threadpool_work m_work;
+
+    // Only used by the consumer.
+    std::unique_ptr<Batch> m_currentBatch;
+    size_t m_currentElement = 0;    // The node Read moved to.
+    size_t m_current = 0;           // That node, or the attribute of it the getters read.
+};
+
 CWinReader::CWinReader(xref_ptr<IXmlReader> reader)
     : m_reader(std::move(reader))
 {}
 
+CWinReader::~CWinReader()
+{}
+
 _Check_return_ HRESULT
 CWinReader::Read(_Out_ XmlNodeType *pType)
 {
+    if (m_pipeline)
+    {
+        return m_pipeline->Read(pType);
+    }
+
     return m_reader->Read(pType);
 }
 
@@ -34,7 +418,8 @@ _Check_return_ HRESULT
 CWinReader::SetInput(
     _In_ unsigned int cBuffer,
     _In_reads_(cBuffer) const uint8_t *pBuffer,
-    _In_ bool bForceUtf16)
+    _In_ bool bForceUtf16,
+    _In_ bool bPipelined)
 {
     void *pvGlob;
     HGLOBAL hGlob;
@@ -78,6 +463,17 @@ CWinReader::SetInput(
         IFC_RETURN(m_reader->SetInput(m_stream));
     }
 
+    if (bPipelined)
+    {
+        m_pipeline = std::make_unique<PipelinedNodeSource>(m_reader);
+
+        if (!m_pipeline->TryStart())
+        {
+            // Nothing has been read yet, so just read directly.
+            m_pipeline.reset();
+        }
+    }
+
     return S_OK;
 }
 
@@ -86,6 +482,12 @@ _Check_return_ HRESULT
 CWinReader::GetPrefix(
     _Inout_ ReaderString *pReaderString)
 {
+    if (m_pipeline)
+    {
+        m_pipeline->GetPrefix(pReaderString);
+        return S_OK;
+    }
+
     const wchar_t* pString = nullptr;
     unsigned int cString = 0;
     IFC_RETURN(m_reader->GetPrefix(&pString, &cString));
@@ -97,6 +499,12 @@ _Check_return_ HRESULT
 CWinReader::GetNamespaceUri(
     _Inout_ ReaderString *pReaderString)
 {
+    if (m_pipeline)
+    {
+        m_pipeline->GetNamespaceUri(pReaderString);
+        return S_OK;
+    }
+
     const wchar_t* pString = nullptr;
     unsigned int cString = 0;
     IFC_RETURN(m_reader->GetNamespaceUri(&pString, &cString));
@@ -108,6 +516,12 @@ _Check_return_ HRESULT
 CWinReader::GetLocalName(
     _Inout_ ReaderString *pReaderString)
 {
+    if (m_pipeline)
+    {
+        m_pipeline->GetLocalName(pReaderString);
+        return S_OK;
+    }
+
     const wchar_t* pString = nullptr;
     unsigned int cString = 0;
     IFC_RETURN(m_reader->GetLocalName(&pString, &cString));
@@ -118,6 +532,12 @@ CWinReader::GetLocalName(
 _Check_return_ HRESULT
 CWinReader::GetValue(_Inout_ ReaderString *pReaderString)
 {
+    if (m_pipeline)
+    {
+        m_pipeline->GetValue(pReaderString);
+        return S_OK;
+    }
+
     const wchar_t* pString = nullptr;
     unsigned int cString = 0;
     IFC_RETURN(m_reader->GetValue(&pString, &cString));
@@ -127,24 +547,45 @@ CWinReader::GetValue(_Inout_ ReaderString *pReaderString)
 
 bool CWinReader::EmptyElement()
 {
+    if (m_pipeline)
+    {
+        return m_pipeline->EmptyElement();
+    }
+
     return !!m_reader->IsEmptyElement();
 }
 
 _Check_return_ HRESULT
 CWinReader::FirstAttribute()
 {
+    if (m_pipeline)
+    {
+        return m_pipeline->FirstAttribute();
+    }
+
     return m_reader->MoveToFirstAttribute();
 }
 
 _Check_return_ HRESULT
 CWinReader::NextAttribute()
 {
+    if (m_pipeline)
+    {
+        return m_pipeline->NextAttribute();
+    }
+
     return m_reader->MoveToNextAttribute();
 }
 
 _Check_return_ HRESULT
 CWinReader::GetPosition(_Out_ unsigned int *pnLine, _Out_ unsigned int *pnColumn)
 {
+    if (m_pipeline)
+    {
+        m_pipeline->GetPosition(pnLine, pnColumn);
+        return S_OK;
+    }
+
     IFC_RETURN(m_reader->GetLineNumber(pnLine));
     IFC_RETURN(m_reader->GetLinePosition(pnColumn));
     return S_OK;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <xmllite.h>
+#include <memory>
 
 class ReaderString;
 class CWinReader;
@@ -16,8 +17,12 @@ class CWinReader
 {
 public:
     explicit CWinReader(xref_ptr<IXmlReader> reader);
+    ~CWinReader();
 
-    _Check_return_ HRESULT SetInput(_In_ unsigned int cBuffer, _In_reads_(cBuffer) const uint8_t *pBuffer, _In_ bool bForceUtf16);
+    // When bPipelined is set, XmlLite reads the document on a thread pool thread, and the
+    // caller consumes the nodes it has read so far. Strings and positions are the same as
+    // reading directly, and so is the error XmlLite stops at.
+    _Check_return_ HRESULT SetInput(_In_ unsigned int cBuffer, _In_reads_(cBuffer) const uint8_t *pBuffer, _In_ bool bForceUtf16, _In_ bool bPipelined = false);
     _Check_return_ HRESULT Read(_Out_ XmlNodeType *pType);
     _Check_return_ HRESULT GetPrefix(_Inout_ ReaderString *pReaderString);
     _Check_return_ HRESULT GetNamespaceUri(_Inout_ ReaderString *pReaderString);
@@ -29,6 +34,11 @@ public:
     _Check_return_ HRESULT GetPosition(_Out_ unsigned int *pnLine, _Out_ unsigned int *pnColumn);
 
 private:
+    class PipelinedNodeSource;
+
     xref_ptr<IStream> m_stream;
     xref_ptr<IXmlReader> m_reader;
+
+    // Reads from m_reader while it's set. Declared last so the worker is done before the stream goes away.
+    std::unique_ptr<PipelinedNodeSource> m_pipeline;
 };
@@ -12,6 +12,7 @@
 #include "ReferenceTrackerInterfaces.h"
 
 #include <wil\resource.h>
+#include <unordered_map>
 
 namespace DirectUI
 {
@@ -174,6 +175,20 @@ namespace DirectUI
         static HRESULT ReleaseFromReferenceTracker(IReferenceTrackerTarget *pTrackerTarget);
         static void ReferenceTrackerWalk(EReferenceTrackerWalkType walkType, IReferenceTrackerTarget *pTrackerTarget);
 
+        // Tracker references that pegged their target when they were set. The next reference tracking
+        // unpegs these directly, which lets the RTW_Unpeg walk skip the peers that weren't pegged.
+        static void AddPendingUnpeg(_In_ TrackerTargetReference *pTrackerPtr);
+        static void RemovePendingUnpeg(_In_ TrackerTargetReference *pTrackerPtr);
+        static void MovePendingUnpeg(_In_ TrackerTargetReference *pFrom, _In_ TrackerTargetReference *pTo);
+
+        // Every peer needs to be walked when targets could have been pegged without being tracked,
+        // which is the case before the first reference tracking. Only valid during the walks of a
+        // reference tracking, which decides it as it starts.
+        static bool IsFullUnpegWalk()
+        {
+            return This->m_isFullUnpegWalk;
+        }
+
         // Keep track of the root context
         static void SetRootOfTrackerWalk(
             _In_opt_ xaml_hosting::IReferenceTrackerInternal *pTrackerRoot,
@@ -334,14 +349,19 @@ namespace DirectUI
         static int _peerCount;
         static int _targetCount;
         static int _unreachableCount;
+        static int _unpegWalkedCount;
+        static int _unpegSkippedCount;
+        static int _pendingUnpegCount;
 
     private:
 
         void ResetLastFindWalkIdForAllPeers();
+        void UnpegPendingTrackerReferences(_In_ IDXamlCore* pCore);
 
         // The single instance of this class
         static ReferenceTrackerManager *This;
         static SRWLOCK s_lock;
+        static SRWLOCK s_pendingUnpegLock;
 
         ULONG _refs;
 
@@ -373,6 +393,15 @@ namespace DirectUI
 
         unsigned short m_currentFindWalkID;
 
+        // Guarded by s_pendingUnpegLock. Each reference is kept with the core it was set on, so
+        // that it's unpegged while that core's references are locked.
+        std::unordered_map<TrackerTargetReference*, IDXamlCore*> m_pendingUnpegs;
+        bool m_walkAllPeersOnUnpeg;
+
+        // m_walkAllPeersOnUnpeg as it was when the current reference tracking started. Only used
+        // by the thread doing the reference tracking.
+        bool m_isFullUnpegWalk;
+
 
     public:
         static bool HaveHost() { return This != nullptr && This->_pReferenceTrackerHost != nullptr; }
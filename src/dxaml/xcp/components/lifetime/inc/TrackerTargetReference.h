@@ -125,6 +125,7 @@ namespace DirectUI
         bool m_extraExpectedRef : 1; // An extra ctl::release_expected is necessary in Clear()
         bool m_isTrackerInternal : 1;
         bool m_isManagedReference : 1;
+        bool m_isUnpegPending : 1;   // In the ReferenceTrackerManager's list of references pegged by Set(), until the next GC
 
 #if DBG
         INSTRUCTION_ADDRESS m_frameAddresses[40];
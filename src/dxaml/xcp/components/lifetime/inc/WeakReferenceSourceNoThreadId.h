@@ -333,6 +333,7 @@ namespace ctl
             bool AddedToReferenceTrackingList : 1; // Has been added to referenceTrackingList
             bool peggedByCoreTable : 1;     // Pegged because it's in core's m_PegNoRefCoreObjectsWithoutPeers
             bool MemoryDiagWalked : 1;   // Flag to indicate object has been visited for memory diagnostics (RTW_GetElementCount, RTW_TotalCompressedImageSize)
+            bool bUnpegPending : 1;      // Pegged a tracker target outside of a walk, so the next RTW_Unpeg walk can't skip it
         } m_referenceTrackerBitFields;
 
         // These protected flags were moved out of DependencyObject to fit into the free padding here
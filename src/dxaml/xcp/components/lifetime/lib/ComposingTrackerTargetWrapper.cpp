@@ -63,6 +63,12 @@ DirectUI::ComposingTrackerTargetWrapper::Ensure(
             // reference tracking, at which point we'll correct it if necessary.
             IFC_RETURN(composingTrackerTarget->Peg());
 
+            // Make sure the next unpeg walk goes through this object, even if it isn't pegged.
+            {
+                AutoReentrantReferenceLock lock(DXamlServices::GetDXamlCore());
+                tracker->m_referenceTrackerBitFields.bUnpegPending = true;
+            }
+
             composingTrackerTarget->Release();
         }
     }
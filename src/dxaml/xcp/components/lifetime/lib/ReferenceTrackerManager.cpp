@@ -18,6 +18,7 @@ using namespace xaml_hosting;
 
 ReferenceTrackerManager* ReferenceTrackerManager::This = NULL;
 SRWLOCK ReferenceTrackerManager::s_lock {SRWLOCK_INIT};
+SRWLOCK ReferenceTrackerManager::s_pendingUnpegLock {SRWLOCK_INIT};
 
 #if XCP_MONITOR
 int ReferenceTrackerManager::s_cPeerStressIteration = 0;
@@ -380,6 +381,9 @@ ReferenceTrackerManager::TriggerCollectionForSuspend( )
 int ReferenceTrackerManager::_peerCount = 0;
 int ReferenceTrackerManager::_targetCount = 0;
 int ReferenceTrackerManager::_unreachableCount = 0;
+int ReferenceTrackerManager::_unpegWalkedCount = 0;
+int ReferenceTrackerManager::_unpegSkippedCount = 0;
+int ReferenceTrackerManager::_pendingUnpegCount = 0;
 
 _Check_return_
 IFACEMETHODIMP
@@ -406,6 +410,17 @@ ReferenceTrackerManager::ReferenceTrackingStarted()
     _peerCount = 0;
     _targetCount = 0;
     _unreachableCount = 0;
+    _unpegWalkedCount = 0;
+    _unpegSkippedCount = 0;
+    _pendingUnpegCount = 0;
+
+    // Decide once, before any core is walked, whether this tracking has to walk every peer. A
+    // request made while the walk runs is left for the next reference tracking.
+    {
+        auto lock = wil::AcquireSRWLockExclusive(&s_pendingUnpegLock);
+        m_isFullUnpegWalk = m_walkAllPeersOnUnpeg;
+        m_walkAllPeersOnUnpeg = false;
+    }
 
 
     #if XCP_MONITOR
@@ -442,7 +457,10 @@ ReferenceTrackerManager::ReferenceTrackingStarted()
 
         PeerMapEntriesHelper peerMap(pCore);
 
-        // Unpeg all tracker targets
+        // Unpeg all tracker targets. The ones pegged when their tracker reference was set are
+        // unpegged here, the rest by walking the peers that were pegged in the last GC.
+
+        UnpegPendingTrackerReferences(pCore);
 
         for (auto it = peerMap.begin(); it != peerMap.end(); ++it)
         {
@@ -519,6 +537,104 @@ ReferenceTrackerManager::ResetLastFindWalkIdForAllPeers()
     }
 }
 
+//
+// Unpeg the tracker references that pegged their target when they were set on this core. This is
+// what the RTW_Unpeg walk of their owner would have done, without having to find the owner.
+//
+void
+ReferenceTrackerManager::UnpegPendingTrackerReferences(_In_ IDXamlCore* pCore)
+{
+    auto lock = wil::AcquireSRWLockExclusive(&s_pendingUnpegLock);
+
+    for (auto it = m_pendingUnpegs.begin(); it != m_pendingUnpegs.end();)
+    {
+        if (it->second == pCore)
+        {
+            TrackerTargetReference* pTrackerPtr = it->first;
+
+            // The reference still holds its target, so unpegging it can't release anything
+            // that would need this lock.
+            // This doesn't check that the reference's owner was reachable in the last GC, as the
+            // owner's RTW_Unpeg walk does. That check protects targets that only the last GC's walks
+            // kept alive, and whose CCW may be disconnected now. A pending reference pegged its
+            // current target when it was set, after the last GC, and that peg is what's removed
+            // here, so the target is still alive however the owner fared.
+            pTrackerPtr->m_isUnpegPending = false;
+            pTrackerPtr->ReferenceTrackerWalk(RTW_Unpeg);
+            _pendingUnpegCount++;
+
+            it = m_pendingUnpegs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//static
+void
+ReferenceTrackerManager::AddPendingUnpeg(_In_ TrackerTargetReference *pTrackerPtr)
+{
+    // Without a manager there hasn't been a reference tracking yet, and the first one walks everything.
+    if (This == nullptr)
+    {
+        return;
+    }
+
+    auto lock = wil::AcquireSRWLockExclusive(&s_pendingUnpegLock);
+
+    IDXamlCore* pCore = DXamlServices::GetDXamlCore();
+    if (pCore == nullptr)
+    {
+        // We can't tell which core's walk should unpeg this, fall back to walking everything.
+        This->m_walkAllPeersOnUnpeg = true;
+        return;
+    }
+
+    This->m_pendingUnpegs[pTrackerPtr] = pCore;
+    pTrackerPtr->m_isUnpegPending = true;
+}
+
+//static
+void
+ReferenceTrackerManager::RemovePendingUnpeg(_In_ TrackerTargetReference *pTrackerPtr)
+{
+    if (This == nullptr)
+    {
+        return;
+    }
+
+    auto lock = wil::AcquireSRWLockExclusive(&s_pendingUnpegLock);
+
+    This->m_pendingUnpegs.erase(pTrackerPtr);
+    pTrackerPtr->m_isUnpegPending = false;
+}
+
+//static
+void
+ReferenceTrackerManager::MovePendingUnpeg(_In_ TrackerTargetReference *pFrom, _In_ TrackerTargetReference *pTo)
+{
+    if (This == nullptr)
+    {
+        return;
+    }
+
+    auto lock = wil::AcquireSRWLockExclusive(&s_pendingUnpegLock);
+
+    pFrom->m_isUnpegPending = false;
+    pTo->m_isUnpegPending = false;
+
+    auto it = This->m_pendingUnpegs.find(pFrom);
+    if (it != This->m_pendingUnpegs.end())
+    {
+        IDXamlCore* pCore = it->second;
+        This->m_pendingUnpegs.erase(it);
+        This->m_pendingUnpegs[pTo] = pCore;
+        pTo->m_isUnpegPending = true;
+    }
+}
+
 //+--------------------------------------------------------------------
 //
 //  FindTrackerTargetsCompleted
@@ -676,6 +792,8 @@ ReferenceTrackerManager::ReferenceTrackingCompleted()
     {
         LOG(L"Reference tracking completed.  Objects=%d, Sources=%d, Targets=%d, Unreachable=%d",
             _peerCount, m_currentFindWalkID, _targetCount, _unreachableCount );
+        LOG(L"Unpeg walk.  Walked=%d, Skipped=%d, PendingReferences=%d",
+            _unpegWalkedCount, _unpegSkippedCount, _pendingUnpegCount );
     }
     #endif
 
@@ -1020,6 +1138,8 @@ ReferenceTrackerManager::ReferenceTrackerManager(  )
     , _pReferenceTrackerHost(nullptr)
     , _refs(0)
     , m_startThreadId(0)
+    , m_walkAllPeersOnUnpeg(true)
+    , m_isFullUnpegWalk(true)
 { }
 
 //+--------------------------------------------------------------------
@@ -245,6 +245,11 @@ TrackerTargetReference::TrackerTargetReference(TrackerTargetReference&& other) n
 
 TrackerTargetReference::~TrackerTargetReference()
 {
+    if (m_isUnpegPending)
+    {
+        ReferenceTrackerManager::RemovePendingUnpeg(this);
+    }
+
     ClearRawValue();
 
 #if DBG
@@ -269,6 +274,7 @@ void TrackerTargetReference::Initialize()
     m_extraExpectedRef = false;
     m_isTrackerInternal = false;
     m_isManagedReference = false;
+    m_isUnpegPending = false;
 
 #if DBG
     m_fStatic = false;
@@ -341,6 +347,11 @@ TrackerTargetReference& TrackerTargetReference::Assign(_In_ TrackerTargetReferen
             other.m_fStatic = false;
             other.m_fHasBeenWalked = false;
 #endif
+
+            if (other.m_isUnpegPending)
+            {
+                ReferenceTrackerManager::MovePendingUnpeg(&other, this);
+            }
         }
     }
 
@@ -470,6 +481,14 @@ void TrackerTargetReference::Set(
             ASSERT(!m_trackerPeg);
             m_trackerPeg = fPegged;
         }
+
+        // Whatever walk reaches our owner next might skip it, so remember to unpeg what we just pegged.
+        // A reference stays in the list until the next reference tracking even if it's cleared or set
+        // again, so setting it again doesn't need to go back to the list.
+        if ((fPegged || m_isManagedReference) && !m_isUnpegPending)
+        {
+            ReferenceTrackerManager::AddPendingUnpeg(this);
+        }
     }
 
 
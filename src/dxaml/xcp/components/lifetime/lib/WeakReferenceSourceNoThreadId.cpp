@@ -370,6 +370,21 @@ WeakReferenceSourceNoThreadId::ReferenceTrackerWalkCore(EReferenceTrackerWalkTyp
             // Clear the flag that indicates we've been pegged because of being in the core's
             // m_PegNoRefCoreObjectsWithoutPeers table.
             m_referenceTrackerBitFields.peggedByCoreTable = false;
+
+            // The only tracker targets that can still be pegged from here are the ones the last
+            // RTW_Peg walk went through, and the ones pegged since then outside of a walk. Tracker
+            // references that pegged their target when they were set have already been unpegged
+            // by the ReferenceTrackerManager, so there's nothing else to walk.
+            if (!m_referenceTrackerBitFields.bPegWalked
+                && !m_referenceTrackerBitFields.bUnpegPending
+                && !ReferenceTrackerManager::IsFullUnpegWalk())
+            {
+                ReferenceTrackerManager::_unpegSkippedCount++;
+                goto Cleanup;
+            }
+
+            m_referenceTrackerBitFields.bUnpegPending = false;
+            ReferenceTrackerManager::_unpegWalkedCount++;
         }
         break;
 
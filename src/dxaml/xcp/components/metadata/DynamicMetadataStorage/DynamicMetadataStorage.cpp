@@ -82,6 +82,8 @@ void DynamicMetadataStorage::ResetInstance()
 
     m_customDPsByTypeAndNameCache           = nullptr;
     m_customPropertiesByTypeAndNameCache    = nullptr;
+    m_bindingPathStepsByTypeAndNameCache    = nullptr;
+    ++m_bindingPathStepsGeneration;
 
     // and save indices for the boundary between stale and good metadata.
 
@@ -46,6 +46,65 @@ static const CDependencyProperty* TryFindCustomPropertyHelper(
     return nullptr;
 }
 
+// Finds the cached resolution of a binding path step, or returns nullptr if the name wasn't resolved on the type yet.
+static const DynamicMetadataStorage::BindingPathStepProperties* TryFindBindingPathStepHelper(
+    _In_ const DynamicMetadataStorage::BindingPathStepsByTypeTable* table,
+    _In_ const CClassInfo* pType,
+    _In_ const xstring_ptr_view& strName)
+{
+    if (table)
+    {
+        auto typeIterator = table->find(pType->GetIndex());
+
+        if (typeIterator != table->end())
+        {
+            auto mapSteps = typeIterator->second.get();
+            auto itMap = mapSteps->find(strName);
+
+            if (itMap != mapSteps->end())
+            {
+                return &itMap->second;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+// Gets the cached resolution of a binding path step, adding an empty one if there isn't one yet.
+static _Check_return_ HRESULT GetBindingPathStepHelper(
+    _In_ DynamicMetadataStorageInstanceWithLock& storage,
+    _In_ const CClassInfo* pType,
+    _In_ const xstring_ptr_view& strName,
+    _Outptr_ DynamicMetadataStorage::BindingPathStepProperties** ppStep)
+{
+    if (storage->m_bindingPathStepsByTypeAndNameCache == nullptr)
+    {
+        storage->m_bindingPathStepsByTypeAndNameCache.reset(new DynamicMetadataStorage::BindingPathStepsByTypeTable());
+    }
+
+    auto& mapSteps = (*storage->m_bindingPathStepsByTypeAndNameCache)[pType->GetIndex()];
+
+    if (mapSteps == nullptr)
+    {
+        mapSteps.reset(new DynamicMetadataStorage::BindingPathStepsTable());
+    }
+
+    auto itMap = mapSteps->find(strName);
+
+    if (itMap != mapSteps->end())
+    {
+        *ppStep = &itMap->second;
+        return S_OK;
+    }
+
+    xstring_ptr strNamePromoted;
+    IFC_RETURN(strName.Promote(&strNamePromoted));
+
+    *ppStep = &(*mapSteps)[std::move(strNamePromoted)];
+    return S_OK;
+}
+
 // Associates a dependency property with a type in a runtime cache.
 _Check_return_ HRESULT MetadataAPI::AssociateDependencyProperty(_In_ const CClassInfo* pType, _In_ const CDependencyProperty* pDP)
 {
@@ -1475,6 +1534,120 @@ _Check_return_ HRESULT MetadataAPI::TryGetPropertyByName(
     return S_OK;
 }
 
+// Try to find a dependency property for a binding path step, remembering the result for the next binding to the same type.
+_Check_return_ HRESULT MetadataAPI::TryGetDependencyPropertyForBindingPathStep(
+    _In_ const CClassInfo* pType,
+    _In_ const xstring_ptr_view& strName,
+    _Outptr_result_maybenull_ const CDependencyProperty** ppDP)
+{
+    *ppDP = nullptr;
+
+    // Built-in properties of built-in types don't need the lock or the cache.
+    if (IsKnownIndex(pType->GetIndex()))
+    {
+        if (const CPropertyBase* builtIn = TryGetBuiltInPropertyBaseByName(pType, strName))
+        {
+            *ppDP = builtIn->AsOrNull<CDependencyProperty>();
+            return S_OK;
+        }
+    }
+
+    XUINT32 generation = 0;
+
+    {
+        DynamicMetadataStorageInstanceWithLock storage;
+
+        auto step = TryFindBindingPathStepHelper(
+            storage->m_bindingPathStepsByTypeAndNameCache.get(),
+            pType,
+            strName);
+
+        if (step && step->m_isDPResolved)
+        {
+            *ppDP = step->m_dp;
+            return S_OK;
+        }
+
+        generation = storage->m_bindingPathStepsGeneration;
+    }
+
+    // Resolve it without holding the lock, this may call into the app's metadata provider.
+    IFC_RETURN(TryGetDependencyPropertyByName(pType, strName, ppDP));
+
+    {
+        DynamicMetadataStorageInstanceWithLock storage;
+
+        // Don't remember a result that a DP registered meanwhile may have made stale.
+        if (storage->m_bindingPathStepsGeneration == generation)
+        {
+            DynamicMetadataStorage::BindingPathStepProperties* step = nullptr;
+
+            IFC_RETURN(GetBindingPathStepHelper(storage, pType, strName, &step));
+            step->m_isDPResolved = true;
+            step->m_dp = *ppDP;
+        }
+    }
+
+    return S_OK;
+}
+
+// Try to find a property for a binding path step, remembering the result for the next binding to the same type.
+_Check_return_ HRESULT MetadataAPI::TryGetPropertyForBindingPathStep(
+    _In_ const CClassInfo* pType,
+    _In_ const xstring_ptr_view& strName,
+    _Outptr_result_maybenull_ const CDependencyProperty** ppProperty)
+{
+    *ppProperty = nullptr;
+
+    // Built-in properties of built-in types don't need the lock or the cache.
+    if (IsKnownIndex(pType->GetIndex()))
+    {
+        if (const CPropertyBase* builtIn = TryGetBuiltInPropertyBaseByName(pType, strName))
+        {
+            *ppProperty = builtIn->AsOrNull<CDependencyProperty>();
+            return S_OK;
+        }
+    }
+
+    XUINT32 generation = 0;
+
+    {
+        DynamicMetadataStorageInstanceWithLock storage;
+
+        auto step = TryFindBindingPathStepHelper(
+            storage->m_bindingPathStepsByTypeAndNameCache.get(),
+            pType,
+            strName);
+
+        if (step && step->m_isPropertyResolved)
+        {
+            *ppProperty = step->m_property;
+            return S_OK;
+        }
+
+        generation = storage->m_bindingPathStepsGeneration;
+    }
+
+    // Resolve it without holding the lock, this may call into the app's metadata provider.
+    IFC_RETURN(TryGetPropertyByName(pType, strName, ppProperty));
+
+    {
+        DynamicMetadataStorageInstanceWithLock storage;
+
+        // Don't remember a result that a DP registered meanwhile may have made stale.
+        if (storage->m_bindingPathStepsGeneration == generation)
+        {
+            DynamicMetadataStorage::BindingPathStepProperties* step = nullptr;
+
+            IFC_RETURN(GetBindingPathStepHelper(storage, pType, strName, &step));
+            step->m_isPropertyResolved = true;
+            step->m_property = *ppProperty;
+        }
+    }
+
+    return S_OK;
+}
+
 // Gets the underlying dependency property from a property. Use this if pProperty may
 // refer to a regular property, and you want the underlying DP for it. If it refers to
 // a DP already, this function will return a reference to that DP.
@@ -6,6 +6,7 @@
 #include <StandardNameScopeTable.h>
 
 #include <CDependencyObject.h>
+#include <XStringInternTable.h>
 #include "NameScopeTableEntry.h"
 
 namespace Jupiter {
@@ -43,7 +44,7 @@ namespace Jupiter {
             else
             {
                 xstring_ptr promotedName;
-                VERIFYHR(name.Promote(&promotedName));
+                VERIFYHR(XStringInternTable::Intern(name, &promotedName));
                 m_entries.emplace_hint(iter, std::move(promotedName), std::move(entry));
             }
         }
@@ -0,0 +1,257 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+
+#include "inc\ResourceResolutionCache.h"
+#include <corep.h>
+#include <Resources.h>
+#include <FrameworkTheming.h>
+#include "XamlTelemetry.h"
+
+namespace Resources {
+
+    ResourceResolutionCache::~ResourceResolutionCache()
+    {
+        // Reports how well the cache did over the lifetime of the UI thread.
+        const Statistics statistics = GetStatistics();
+
+        TraceLoggingProviderWrite(
+            XamlTelemetry, "Resources_ResourceResolutionCacheStatistics",
+            TraceLoggingUInt64(statistics.Hits, "Hits"),
+            TraceLoggingUInt64(statistics.Misses, "Misses"),
+            TraceLoggingUInt64(statistics.StaleEntries, "StaleEntries"),
+            TraceLoggingUInt64(statistics.Entries, "Entries"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
+    /* static */ std::uint64_t ResourceResolutionCache::NextDictionaryVersion()
+    {
+        static std::atomic<std::uint64_t> s_nextVersion { 0 };
+        return ++s_nextVersion;
+    }
+
+    /* static */ Theming::Theme ResourceResolutionCache::GetEffectiveTheme(_In_ CCoreServices* core)
+    {
+        // Mirrors how CResourceDictionary::EnsureActiveThemeDictionary picks the active theme dictionary.
+        auto theming = core->GetFrameworkTheming();
+
+        if (!theming)
+        {
+            return Theming::Theme::None;
+        }
+
+        auto theme = core->IsThemeRequestedForSubTree() ? core->GetRequestedThemeForSubTree() : theming->GetBaseTheme();
+        return theme | theming->GetHighContrastTheme();
+    }
+
+    bool ResourceResolutionCache::CacheKey::operator==(const CacheKey& other) const
+    {
+        return ScopeDictionary == other.ScopeDictionary
+            && KeyHash == other.KeyHash
+            && KeyIsType == other.KeyIsType
+            && Scope == other.Scope
+            && Theme == other.Theme;
+    }
+
+    std::size_t ResourceResolutionCache::CacheKeyHash::operator()(const CacheKey& value) const
+    {
+        std::size_t hash = value.KeyHash;
+        hash ^= std::hash<void*>()(value.ScopeDictionary) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= (static_cast<std::size_t>(value.Scope) << 8) | static_cast<std::size_t>(value.Theme);
+        return hash;
+    }
+
+    /* static */ ResourceResolutionCache::CacheKey ResourceResolutionCache::MakeCacheKey(
+        _In_ CResourceDictionary* scopeDictionary,
+        const ResourceKey& key,
+        LookupScope scope,
+        Theming::Theme theme)
+    {
+        return CacheKey { scopeDictionary, key.hash(), key.IsKeyType(), scope, theme };
+    }
+
+    /* static */ bool ResourceResolutionCache::IsCurrent(const CacheEntry& entry)
+    {
+        if (entry.Value.expired())
+        {
+            return false;
+        }
+
+        for (const auto& step : entry.Path)
+        {
+            CResourceDictionary* dictionary = step.first.lock_noref();
+
+            if (!dictionary || dictionary->GetVersion() != step.second)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ResourceResolutionCache::ValidateGlobalDictionaries(_In_ CCoreServices* core)
+    {
+        CResourceDictionary* applicationResources = core->GetApplicationResourceDictionary();
+        CResourceDictionary* themeResources = core->GetThemeResourcesNoCreate();
+
+        if (applicationResources != m_applicationResources || themeResources != m_themeResources)
+        {
+            Clear();
+            m_applicationResources = applicationResources;
+            m_themeResources = themeResources;
+        }
+    }
+
+    bool ResourceResolutionCache::TryGet(
+        _In_ CCoreServices* core,
+        _In_ CResourceDictionary* scopeDictionary,
+        const ResourceKey& key,
+        LookupScope scope,
+        Theming::Theme theme,
+        _Outptr_result_maybenull_ CDependencyObject** valueNoRef,
+        _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom)
+    {
+        *valueNoRef = nullptr;
+
+        ValidateGlobalDictionaries(core);
+
+        auto bucket = m_entries.find(MakeCacheKey(scopeDictionary, key, scope, theme));
+
+        if (bucket == m_entries.end())
+        {
+            ++m_misses;
+            return false;
+        }
+
+        auto& entries = bucket->second;
+        auto iter = std::find_if(entries.begin(), entries.end(),
+            [&](const CacheEntry& entry)
+            {
+                return key == entry.Key;
+            });
+
+        if (iter == entries.end())
+        {
+            ++m_misses;
+            return false;
+        }
+
+        if (!IsCurrent(*iter))
+        {
+            ++m_staleEntries;
+            ++m_misses;
+            --m_entryCount;
+
+            entries.erase(iter);
+            if (entries.empty())
+            {
+                m_entries.erase(bucket);
+            }
+            return false;
+        }
+
+        ++m_hits;
+        *valueNoRef = iter->Value.lock_noref();
+
+        if (dictionaryReadFrom)
+        {
+            *dictionaryReadFrom = iter->DictionaryReadFrom.lock();
+        }
+
+        return true;
+    }
+
+    void ResourceResolutionCache::BeginRecording()
+    {
+        ASSERT(!m_isRecording);
+        m_recordedDictionaries.clear();
+        m_isRecording = true;
+    }
+
+    void ResourceResolutionCache::AbandonRecording()
+    {
+        m_isRecording = false;
+        m_recordedDictionaries.clear();
+    }
+
+    void ResourceResolutionCache::CommitRecording(
+        _In_ CResourceDictionary* scopeDictionary,
+        const ResourceKey& key,
+        LookupScope scope,
+        Theming::Theme theme,
+        _In_opt_ CDependencyObject* valueNoRef,
+        _In_opt_ CResourceDictionary* dictionaryReadFrom)
+    {
+        ASSERT(m_isRecording);
+        m_isRecording = false;
+
+        // Negative results aren't cached here. The per-dictionary keys-not-found cache already covers them, and
+        // deferred keys being faulted in would otherwise need to invalidate them.
+        if (valueNoRef)
+        {
+            if (m_entryCount >= c_maxEntries)
+            {
+                Clear();
+            }
+
+            CacheEntry entry;
+            entry.Key = key.ToStorage();
+            entry.Value = xref::get_weakref(valueNoRef);
+            entry.DictionaryReadFrom = xref::get_weakref(dictionaryReadFrom);
+
+            entry.Path.reserve(m_recordedDictionaries.size() + 1);
+            entry.Path.emplace_back(xref::get_weakref(scopeDictionary), scopeDictionary->GetVersion());
+
+            for (CResourceDictionary* dictionary : m_recordedDictionaries)
+            {
+                auto found = std::find_if(entry.Path.begin(), entry.Path.end(),
+                    [dictionary](const auto& step)
+                    {
+                        return step.first.lock_noref() == dictionary;
+                    });
+
+                if (found == entry.Path.end())
+                {
+                    entry.Path.emplace_back(xref::get_weakref(dictionary), dictionary->GetVersion());
+                }
+            }
+
+            auto& entries = m_entries[MakeCacheKey(scopeDictionary, key, scope, theme)];
+            auto existing = std::find_if(entries.begin(), entries.end(),
+                [&](const CacheEntry& other)
+                {
+                    return key == other.Key;
+                });
+
+            if (existing != entries.end())
+            {
+                *existing = std::move(entry);
+            }
+            else
+            {
+                entries.push_back(std::move(entry));
+                ++m_entryCount;
+            }
+        }
+
+        m_recordedDictionaries.clear();
+    }
+
+    void ResourceResolutionCache::Clear()
+    {
+        m_entries.clear();
+        m_entryCount = 0;
+    }
+
+    ResourceResolutionCache::Statistics ResourceResolutionCache::GetStatistics() const
+    {
+        Statistics statistics;
+        statistics.Hits = m_hits;
+        statistics.Misses = m_misses;
+        statistics.StaleEntries = m_staleEntries;
+        statistics.Entries = m_entryCount;
+        return statistics;
+    }
+}
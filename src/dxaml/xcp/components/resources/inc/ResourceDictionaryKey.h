@@ -4,6 +4,7 @@
 #pragma once
 
 #include <xstring_ptr.h>
+#include <XStringInternTable.h>
 
 namespace ResourceDictionaryKey
 {
@@ -114,10 +115,12 @@ struct ResourceKey
         return m_hashAndIsKeyType & ResourceDictionaryKey::details::c_isTypeKeyMask;
     }
 
+    // Stored keys are interned, so keys for the same resource in different dictionaries share their
+    // storage and compare equal without looking at the characters.
     ResourceKeyStorage ToStorage() const
     {
         xstring_ptr key;
-        IFCFAILFAST(m_key.Promote(&key));
+        IFCFAILFAST(XStringInternTable::Intern(m_key, &key));
         return ResourceKeyStorage(key, m_hashAndIsKeyType);
     }
 
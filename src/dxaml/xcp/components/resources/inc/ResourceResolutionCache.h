@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <xstring_ptr.h>
+#include "weakref_ptr.h"
+#include "ResourceDictionaryKey.h"
+#include <theming\inc\theme.h>
+
+class CResourceDictionary;
+class CDependencyObject;
+class CCoreServices;
+
+namespace Resources {
+
+    enum class LookupScope : unsigned char;
+
+    // Memoizes resource dictionary lookups across the whole lifetime of a UI thread (as opposed to
+    // ThemeWalkResourceCache, which only caches for the duration of a theme walk).
+    //
+    // Entries are keyed by (scope dictionary, key, lookup scope, effective theme). Each entry remembers the
+    // version of every dictionary that was consulted while the value was resolved - the scope dictionary
+    // itself, its merged and theme dictionaries, the global theme resources and Application.Resources.
+    // CResourceDictionary hands out a new version whenever it mutates in a way that could change the outcome of a
+    // lookup, so an entry is reused only if nothing on its resolution path has changed since it was recorded.
+    class ResourceResolutionCache
+    {
+    public:
+        struct Statistics
+        {
+            std::uint64_t Hits = 0;
+            std::uint64_t Misses = 0;
+            std::uint64_t StaleEntries = 0;
+            std::size_t Entries = 0;
+        };
+
+        ResourceResolutionCache() = default;
+        ~ResourceResolutionCache();
+        ResourceResolutionCache(const ResourceResolutionCache&) = delete;
+        ResourceResolutionCache& operator=(const ResourceResolutionCache&) = delete;
+
+        // Versions are drawn from a single process-wide sequence, so a dictionary allocated at the address of a
+        // released one can never match a stale entry.
+        static std::uint64_t NextDictionaryVersion();
+
+        static Theming::Theme GetEffectiveTheme(_In_ CCoreServices* core);
+
+        // This does not add-ref the returned value. Returns false on a miss, or if the entry is stale.
+        bool TryGet(
+            _In_ CCoreServices* core,
+            _In_ CResourceDictionary* scopeDictionary,
+            const ResourceKey& key,
+            LookupScope scope,
+            Theming::Theme theme,
+            _Outptr_result_maybenull_ CDependencyObject** valueNoRef,
+            _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom);
+
+        // Recording captures every dictionary that is entered while a lookup is resolved. Recordings don't nest:
+        // lookups made while one is in progress bypass the cache and contribute to the outer recording instead.
+        bool IsRecording() const { return m_isRecording; }
+        void BeginRecording();
+        void AbandonRecording();
+
+        void CommitRecording(
+            _In_ CResourceDictionary* scopeDictionary,
+            const ResourceKey& key,
+            LookupScope scope,
+            Theming::Theme theme,
+            _In_opt_ CDependencyObject* valueNoRef,
+            _In_opt_ CResourceDictionary* dictionaryReadFrom);
+
+        void OnEnterDictionary(_In_ CResourceDictionary* dictionary)
+        {
+            if (m_isRecording)
+            {
+                m_recordedDictionaries.push_back(dictionary);
+            }
+        }
+
+        void Clear();
+
+        Statistics GetStatistics() const;
+
+    private:
+        // Keys only carry the hash of the resource key, so that lookups don't need to promote transient keys. Entries
+        // whose resource keys collide share a bucket and are told apart by CacheEntry::Key.
+        struct CacheKey
+        {
+            CResourceDictionary* ScopeDictionary;
+            std::size_t KeyHash;
+            bool KeyIsType;
+            LookupScope Scope;
+            Theming::Theme Theme;
+
+            bool operator==(const CacheKey& other) const;
+        };
+
+        struct CacheKeyHash
+        {
+            std::size_t operator()(const CacheKey& value) const;
+        };
+
+        struct CacheEntry
+        {
+            ResourceKeyStorage Key;
+            xref::weakref_ptr<CDependencyObject> Value;
+            xref::weakref_ptr<CResourceDictionary> DictionaryReadFrom;
+
+            // The scope dictionary is always the first element of the path.
+            std::vector<std::pair<xref::weakref_ptr<CResourceDictionary>, std::uint64_t>> Path;
+        };
+
+        static CacheKey MakeCacheKey(
+            _In_ CResourceDictionary* scopeDictionary,
+            const ResourceKey& key,
+            LookupScope scope,
+            Theming::Theme theme);
+
+        static bool IsCurrent(const CacheEntry& entry);
+
+        // Replacing Application.Resources or the global theme resources changes where lookups fall back to without
+        // mutating any dictionary on a recorded path, so drop everything when that happens.
+        void ValidateGlobalDictionaries(_In_ CCoreServices* core);
+
+        // Resolution is cheap to redo, so rather than tracking recency we drop everything once this is exceeded.
+        static constexpr std::size_t c_maxEntries = 16384;
+
+        std::unordered_map<CacheKey, std::vector<CacheEntry>, CacheKeyHash> m_entries;
+        std::size_t m_entryCount = 0;
+        std::vector<CResourceDictionary*> m_recordedDictionaries;
+        bool m_isRecording = false;
+
+        // Only compared for identity, never dereferenced.
+        CResourceDictionary* m_applicationResources = nullptr;
+        CResourceDictionary* m_themeResources = nullptr;
+
+        std::uint64_t m_hits = 0;
+        std::uint64_t m_misses = 0;
+        std::uint64_t m_staleEntries = 0;
+    };
+}
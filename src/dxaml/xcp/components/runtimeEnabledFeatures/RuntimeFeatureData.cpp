@@ -83,5 +83,9 @@ namespace RuntimeFeatureBehavior
         { L"ForceDWriteTypographicModel", RuntimeEnabledFeature::ForceDWriteTypographicModel, false, 0, 0 },
         // If XAML dispatch is paused, then to allow process without creating the reentrancy guard, else to enable the reentrancy checks.
         { L"EnableReentrancyChecksAllowPaused", RuntimeEnabledFeature::EnableReentrancyChecksAllowPaused, false, 0, 0 },
+        { L"UseSlabAllocator", RuntimeEnabledFeature::UseSlabAllocator, false, 0, 0 },
+        { L"PipelineXamlTextParsing", RuntimeEnabledFeature::PipelineXamlTextParsing, false, 0, 0 },
+        { L"DeferOffscreenLineFormatting", RuntimeEnabledFeature::DeferOffscreenLineFormatting, false, 0, 0 },
+        { L"CacheAnimatedImageFrames", RuntimeEnabledFeature::CacheAnimatedImageFrames, false, 0, 0 },
     };
 }
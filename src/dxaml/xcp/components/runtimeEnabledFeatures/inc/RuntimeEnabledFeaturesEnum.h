@@ -75,6 +75,10 @@ namespace RuntimeFeatureBehavior
         DisableDWriteTypographicModel,
         ForceDWriteTypographicModel,        // overides DisableDWriteTypographicModel
         EnableReentrancyChecksAllowPaused, // If XAML dispatch is paused, then to allow process without creating the reentrancy guard, else to enable the reentrancy checks.
+        UseSlabAllocator,   // Allocates core objects from size-class slabs instead of the heap.
+        PipelineXamlTextParsing,    // Tokenizes large XAML text on a thread pool thread while it's being loaded.
+        DeferOffscreenLineFormatting,   // Formats the lines of long RichTextBlock paragraphs over several frames.
+        CacheAnimatedImageFrames,   // Keeps decoded animated GIF frames so loops and other elements showing the image reuse them.
 
         // Insert new enum values before this one.
         // This is used to initialize the lengths of the
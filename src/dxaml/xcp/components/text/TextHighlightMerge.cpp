@@ -2,139 +2,146 @@
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
 #include "precomp.h"
-#include <map>
-#include <functional>
-#include <memory>
+#include <algorithm>
+#include <vector>
 #include "TextHighlightMerge.h"
 #include "HighlightRegion.h"
 
 void TextHighlightMerge::AddRegion(
-    _In_ std::shared_ptr<HighlightRegion> highlightRegion
+    const HighlightRegion& highlightRegion
     )
 {
-    // The most recent region always wins.
-    ASSERT(highlightRegion->endIndex >= highlightRegion->startIndex);
+    ASSERT(highlightRegion.endIndex >= highlightRegion.startIndex);
 
-    // OPTIMIZE: Doing a find which is logn followed by an emplace which is logn
-    //                     is not the most optimal way of doing things.  The reason it is done this way
-    //                     is because emplace will remove the previous entry if there is a collision.  See
-    //                     about making an emplace that will return the previous entry.
-    auto emplaceIter = m_regions.find(highlightRegion->startIndex);
+    m_addedRegions.push_back(highlightRegion);
+    m_isMerged = false;
+}
 
-    if (emplaceIter == m_regions.end())
+void TextHighlightMerge::AddRegions(
+    _In_reads_(count) const HighlightRegion* highlightRegions,
+    std::size_t count
+    )
+{
+    if (count > 0)
     {
-        // Element doesn't exist yet, emplace it
-        auto emplaceRet = m_regions.emplace(highlightRegion->startIndex, std::move(highlightRegion));
-        emplaceIter = emplaceRet.first;
-        auto emplacedHighlightRegion = emplaceIter->second.get();
-
-        // First look at the item immediately before this one.
-        // Since nothing can overlap the previous item, only one previous item
-        // needs to be checked.
-        if (emplaceIter != m_regions.begin())
+#if DBG
+        for (std::size_t i = 0; i < count; ++i)
         {
-            auto prevIter = emplaceIter;
-            prevIter--;
-
-            auto currentHighlightRegion = prevIter->second.get();
-
-            // Check for partial overlap case
-            if (emplacedHighlightRegion->startIndex <= currentHighlightRegion->endIndex)
-            {
-                // Handle partial overlap case
-                // === Example ===
-                // BEFORE: ...BBB...
-                // AFTER:  ...BBRR..
-
-                if (emplacedHighlightRegion->endIndex < currentHighlightRegion->endIndex)
-                {
-                    // The new range bisects the previous range so another range is necessary after
-                    // the new range is complete.  It is safe to add to the map here since it will
-                    // be placed after prevIter due to key ordering for std::map.
-                    // === Example ===
-                    // BEFORE: ...BBBB...
-                    // AFTER:  ...BRRB...
-                    auto newRegion = std::make_shared<HighlightRegion>(
-                        emplacedHighlightRegion->endIndex + 1,
-                        currentHighlightRegion->endIndex,
-                        currentHighlightRegion->foregroundBrush,
-                        currentHighlightRegion->backgroundBrush);
-
-                    m_regions.emplace(newRegion->startIndex, std::move(newRegion));
-                }
-
-                currentHighlightRegion->endIndex = emplacedHighlightRegion->startIndex - 1;
-
-                ASSERT(currentHighlightRegion->endIndex >= currentHighlightRegion->startIndex);
-            }
+            ASSERT(highlightRegions[i].endIndex >= highlightRegions[i].startIndex);
         }
+#endif
+
+        m_addedRegions.insert(m_addedRegions.end(), highlightRegions, highlightRegions + count);
+        m_isMerged = false;
     }
-    else
+}
+
+void TextHighlightMerge::Reserve(std::size_t count)
+{
+    m_addedRegions.reserve(count);
+}
+
+void TextHighlightMerge::Clear()
+{
+    m_addedRegions.clear();
+    m_mergedRegions.clear();
+    m_isMerged = true;
+}
+
+void TextHighlightMerge::EnsureMerged()
+{
+    if (m_isMerged)
     {
-        auto emplacedHighlightRegion = emplaceIter->second.get();
+        return;
+    }
 
-        // There as an index collision so split the node if necessary.
-        // === Example ===
-        // BEFORE: ...BBB...
-        // AFTER:  ...RRB...
-        if (highlightRegion->endIndex < emplacedHighlightRegion->endIndex)
-        {
-            auto newRegion = std::make_shared<HighlightRegion>(
-                highlightRegion->endIndex + 1,
-                emplacedHighlightRegion->endIndex,
-                emplacedHighlightRegion->foregroundBrush,
-                emplacedHighlightRegion->backgroundBrush);
+    m_isMerged = true;
+    m_mergedRegions.clear();
 
-            m_regions.emplace(newRegion->startIndex, std::move(newRegion));
-        }
+    const auto regionCount = static_cast<std::uint32_t>(m_addedRegions.size());
 
-        // Move the new highlight region into the found node
-        emplaceIter->second = std::move(highlightRegion);
+    // Visit regions in order of their start index.  Regions that start at the same index are
+    // visited in the order they were added, although that doesn't affect the outcome.
+    m_order.resize(regionCount);
+    for (std::uint32_t i = 0; i < regionCount; ++i)
+    {
+        m_order[i] = i;
     }
 
-    // Next look after and do any necessary region splits
-    auto emplacedHighlightRegion = emplaceIter->second.get();
+    std::stable_sort(m_order.begin(), m_order.end(),
+        [this](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return m_addedRegions[lhs].startIndex < m_addedRegions[rhs].startIndex;
+        });
+
+    // Max-heap of the regions covering the current index, keyed by insertion order so the top is
+    // always the most recently added one.  Regions that have ended are only dropped once they reach
+    // the top.
+    m_active.clear();
 
-    auto nextIter = emplaceIter;
-    nextIter++;
-    while (nextIter != m_regions.end())
+    std::uint32_t nextInOrder = 0;
+    std::uint32_t lastMerged = regionCount;
+    int currentIndex = 0;
+
+    while (nextInOrder < regionCount || !m_active.empty())
     {
-        auto currentHighlightRegion = nextIter->second.get();
+        if (m_active.empty())
+        {
+            // Skip the gap to the next region.
+            currentIndex = m_addedRegions[m_order[nextInOrder]].startIndex;
+        }
+
+        // Start tracking every region that begins at the current index.
+        while (nextInOrder < regionCount &&
+               m_addedRegions[m_order[nextInOrder]].startIndex <= currentIndex)
+        {
+            m_active.push_back(m_order[nextInOrder++]);
+            std::push_heap(m_active.begin(), m_active.end());
+        }
+
+        // Drop regions that ended before the current index.
+        while (!m_active.empty() &&
+               m_addedRegions[m_active.front()].endIndex < currentIndex)
+        {
+            std::pop_heap(m_active.begin(), m_active.end());
+            m_active.pop_back();
+        }
 
-        if (emplacedHighlightRegion->endIndex >= currentHighlightRegion->endIndex)
+        if (m_active.empty())
         {
-            // The highlighter completely occludes this region, so add it to the removal list.
-            // === Example ===
-            // BEFORE: ...BBB...
-            // AFTER:  ..RRRRR..
-            nextIter = m_regions.erase(nextIter);
+            continue;
+        }
+
+        const std::uint32_t topmost = m_active.front();
+        const HighlightRegion& topmostRegion = m_addedRegions[topmost];
+
+        // The topmost region wins until it ends or until the next region starts, since that one
+        // might have been added later.
+        int segmentEnd = topmostRegion.endIndex;
+        if (nextInOrder < regionCount)
+        {
+            segmentEnd = std::min(segmentEnd, m_addedRegions[m_order[nextInOrder]].startIndex - 1);
+        }
+
+        ASSERT(segmentEnd >= currentIndex);
+
+        // A region that was interrupted by a region it occludes continues where it left off, so
+        // extend the previous segment instead of starting a new one.
+        if (lastMerged == topmost &&
+            m_mergedRegions.back().endIndex == currentIndex - 1)
+        {
+            m_mergedRegions.back().endIndex = segmentEnd;
         }
         else
         {
-            // Check for partial overlap case
-            // === Example ===
-            // BEFORE: ...BBB...
-            // AFTER:  ..RRBB...
-            if (emplacedHighlightRegion->endIndex >= currentHighlightRegion->startIndex)
-            {
-
-                auto newRegion = std::make_shared<HighlightRegion>(
-                    emplacedHighlightRegion->endIndex + 1,
-                    currentHighlightRegion->endIndex,
-                    currentHighlightRegion->foregroundBrush,
-                    currentHighlightRegion->backgroundBrush);
-                
-                // Replace the current entry with a new insertion
-                m_regions.erase(nextIter);
-                m_regions.emplace(newRegion->startIndex, std::move(newRegion));
-
-                // NOTE: It is not possible to bi-sect an element that follows after because the
-                //       following regions are guaranteed to be greater based on the incremental
-                //       nature of the algorithm guaranteeing no overlaps.
-            }
-
-            // End the iteration since endIndex cannot intersect anymore ranges
-            break;
+            m_mergedRegions.emplace_back(
+                currentIndex,
+                segmentEnd,
+                topmostRegion.foregroundBrush,
+                topmostRegion.backgroundBrush);
+            lastMerged = topmost;
         }
+
+        currentIndex = segmentEnd + 1;
     }
 }
@@ -76,6 +76,9 @@ namespace
         // earlier items in the collection get overwritten by later ones.
         TextHighlightMerge merge;
 
+        // The valid regions of one highlighter, or of the selections, handed to the merge in one batch.
+        std::vector<HighlightRegion> regions;
+
         if (textHighlighters)
         {
             xref_ptr<CSolidColorBrush> defaultForegroundBrush;
@@ -85,6 +88,13 @@ namespace
                 defaultForegroundBrush,
                 defaultBackgroundBrush));
 
+            std::size_t rangeCount = textSelections.size();
+            for (const auto& textHighlighterDO : textHighlighters->GetCollection())
+            {
+                rangeCount += do_pointer_cast<CTextHighlighter>(textHighlighterDO)->GetRanges()->GetCollection().size();
+            }
+            merge.Reserve(rangeCount);
+
             for (const auto& textHighlighterDO : textHighlighters->GetCollection())
             {
                 auto textHighlighter = do_pointer_cast<CTextHighlighter>(textHighlighterDO);
@@ -111,6 +121,8 @@ namespace
                 }
 
                 ASSERT(textHighlighter->GetRanges());
+                regions.clear();
+
                 for (const auto& textRange : textHighlighter->GetRanges()->GetCollection())
                 {
                     // Resolve the highlight rects
@@ -125,33 +137,33 @@ namespace
                         (endOffset >= 0) &&
                         (startOffset <= endOffset))
                     {
-                        merge.AddRegion(
-                            std::make_shared<HighlightRegion>(
-                                startOffset,
-                                endOffset,
-                                highlightForegroundBrush,
-                                highlightBackgroundBrush));
+                        regions.emplace_back(
+                            startOffset,
+                            endOffset,
+                            highlightForegroundBrush,
+                            highlightBackgroundBrush);
                     }
                 }
+
+                merge.AddRegions(regions.data(), regions.size());
             }
         }
 
         if (!textSelections.empty())
         {
-            for (HighlightRegion selection : textSelections)
+            regions.clear();
+
+            for (const HighlightRegion& selection : textSelections)
             {
                 if (selection.startIndex >= 0 &&
                     selection.endIndex >= 0 &&
                     selection.startIndex <= selection.endIndex)
                 {
-                    merge.AddRegion(
-                        std::make_shared<HighlightRegion>(
-                            selection.startIndex,
-                            selection.endIndex,
-                            selection.foregroundBrush,
-                            selection.backgroundBrush));
+                    regions.push_back(selection);
                 }
             }
+
+            merge.AddRegions(regions.data(), regions.size());
         }
 
         // Iterate over the merged collection
@@ -159,9 +171,9 @@ namespace
         // Whereas TextRangeToTextBounds works on [Start,End), so 1 is incremented
         // to the endIndex to compensate.  Additionally, endOffset was appropriately adjusted
         // based on the length of the range when the regions were added to the merge algorithm.
-        for (const auto& mergeMapItem : merge)
+        for (const auto& mergedRegion : merge)
         {
-            auto highlightRegion = mergeMapItem.second.get();
+            auto highlightRegion = &mergedRegion;
 
             // Get the highlight rects
             uint32_t rectangleCount = 0;
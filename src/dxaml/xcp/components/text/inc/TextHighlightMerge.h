@@ -3,16 +3,14 @@
 
 #pragma once
 
-#include <map>
-#include <functional>
-#include <memory>
+#include <vector>
+#include "HighlightRegion.h"
 
 class CSolidColorBrush;
-class HighlightRegion;
 
 // This algorithm is meant to take a series of linear text ranges and remove any overlap such
-// that all text ranges do not start or end with an intersection.  This is done iteratively by
-// adding regions to the class and then iterating over the map when complete.  The reason for doing
+// that all text ranges do not start or end with an intersection.  This is done by adding regions
+// to the class and then iterating over the merged regions when complete.  The reason for doing
 // this is so that foreground color highlighting chooses the correct color to generate for the
 // glyph primitive.  There are multiple cases to consider which are tested in the unit tests
 // and commented in the algorithm.
@@ -22,11 +20,15 @@ class HighlightRegion;
 //      - All ranges are inclusive [Start,End] since it makes more conceptual sense.
 //        For instance: [1,2] would highlight text index 1 and 2.  [1,1] would highlight text index 1.
 //
-// This algorithm is specifically built with std::map because it uses a red-black tree to
-// insert items by key in sorted order and supports iterating over elements.  This allows
-// the algorithm to work in amortized O(NlogN) time where N is the number of regions.  It also
-// needs to be balanced in case all highlights are added in sequential order.
-// TODO: This could be switched to std::set which might clean things up a bit.
+// Adding a region only appends it to a flat array, so callers with many regions (e.g. search
+// highlighting applying tens of thousands of TextHighlighter ranges) don't pay for rebalancing a
+// tree on every insertion.  The merge happens once, on the first iteration after regions were added:
+// regions are sorted by start index and swept left to right while a heap keyed by insertion order
+// tracks which of the regions covering the current index is the most recent one.  This runs in
+// O(NlogN) time where N is the number of regions, regardless of the order they were added in.
+//
+// Regions are stored by value in arrays owned by the merge, and Clear() keeps their capacity, so a
+// single instance can be reused to merge several batches without allocating per region.
 //
 // It is currently specific to TextHighlighter regions but it could be extended and templatized
 // in the future with little work.
@@ -35,16 +37,35 @@ class TextHighlightMerge
 public:
 
     // Types
-    using MapType = std::map<int, std::shared_ptr<HighlightRegion>>;
+    using RegionsType = std::vector<HighlightRegion>;
 
     // Methods
-    void AddRegion(_In_ std::shared_ptr<HighlightRegion> highlightRegion);
+    void AddRegion(const HighlightRegion& highlightRegion);
+
+    void AddRegions(
+        _In_reads_(count) const HighlightRegion* highlightRegions,
+        std::size_t count);
+
+    void Reserve(std::size_t count);
+
+    void Clear();
 
-    // Iteration
-    MapType::const_iterator begin() { return m_regions.begin(); }
-    MapType::const_iterator end() { return m_regions.end(); }
+    // Iteration.  Regions are non-overlapping and sorted by start index.
+    RegionsType::const_iterator begin() { EnsureMerged(); return m_mergedRegions.begin(); }
+    RegionsType::const_iterator end() { EnsureMerged(); return m_mergedRegions.end(); }
 
 private:
 
-    MapType m_regions;
-};
\ No newline at end of file
+    void EnsureMerged();
+
+    // Regions in the order they were added.  A region's index doubles as its priority.
+    RegionsType m_addedRegions;
+
+    RegionsType m_mergedRegions;
+
+    // Scratch storage for the merge, kept around to reuse its capacity.
+    std::vector<std::uint32_t> m_order;
+    std::vector<std::uint32_t> m_active;
+
+    bool m_isMerged = true;
+};
@@ -6,20 +6,18 @@
 #include <ThemeWalkResourceCache.h>
 #include <CDependencyObject.h>
 #include "wil\result.h"
+#include "XamlTelemetry.h"
 
 wil::details::lambda_call<std::function<void()>> ThemeWalkResourceCache::BeginCachingThemeResources()
 {
     if (!m_isCachingThemeResources)
     {
         m_isCachingThemeResources = true;
+        m_statistics = Statistics();
+
         return wil::scope_exit(std::function<void()>([this]()
             {
-                m_isCachingThemeResources = false;
-                m_resourceCache.clear();
-
-#if XCP_MONITOR
-                m_resourceCache.shrink_to_fit();
-#endif
+                EndCachingThemeResources();
             }));
     }
     else
@@ -28,17 +26,53 @@ wil::details::lambda_call<std::function<void()>> ThemeWalkResourceCache::BeginCa
     }
 }
 
+void ThemeWalkResourceCache::EndCachingThemeResources()
+{
+    m_isCachingThemeResources = false;
+    m_statistics.Entries = m_liveEntryCount;
+
+    TraceLoggingProviderWrite(
+        XamlTelemetry, "Theming_ThemeWalkResourceCacheStatistics",
+        TraceLoggingUInt32(m_statistics.Hits, "Hits"),
+        TraceLoggingUInt32(m_statistics.Misses, "Misses"),
+        TraceLoggingUInt32(m_statistics.Entries, "Entries"),
+        TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+
+    // Everything cached so far belongs to an older generation now.
+    ++m_generation;
+    m_liveEntryCount = 0;
+
+    if (m_generation == 0 || m_resourceCache.size() > c_maxRetainedBuckets)
+    {
+        // Either the generation counter wrapped around, in which case items from long ago could look current, or this
+        // walk left behind too many buckets to be worth keeping around.
+        m_resourceCache.clear();
+
+#if XCP_MONITOR
+        CacheType().swap(m_resourceCache);
+#endif
+    }
+}
+
 void ThemeWalkResourceCache::RemoveThemeResourceCacheEntry(_In_ const xstring_ptr_view& resourceKey)
 {
-    if (m_isCachingThemeResources && m_resourceCache.size() > 0)
+    if (m_isCachingThemeResources && m_liveEntryCount > 0)
     {
-        m_resourceCache.erase(
-            std::remove_if(m_resourceCache.begin(), m_resourceCache.end(),
-                [&](const CacheItemType& item)
+        auto bucket = m_resourceCache.find(resourceKey.GetHash());
+
+        if (bucket != m_resourceCache.end())
+        {
+            for (auto& item : bucket->second)
+            {
+                if (item.Generation == m_generation && item.Key.Equals(resourceKey))
                 {
-                    return std::get<2>(item).Equals(resourceKey);
-                }),
-            m_resourceCache.end());
+                    // Retire the item rather than erasing it, so its slot can be reused.
+                    item.Generation = m_generation - 1;
+                    item.Resource.reset();
+                    --m_liveEntryCount;
+                }
+            }
+        }
     }
 }
 
@@ -47,6 +81,29 @@ void ThemeWalkResourceCache::SetSubTreeTheme(Theming::Theme theme)
     m_subTreeTheme = theme;
 }
 
+ThemeWalkResourceCache::CacheItem* ThemeWalkResourceCache::FindCacheItem(
+    _In_ CResourceDictionary* targetDictionary,
+    _In_ const xstring_ptr& resourceKey)
+{
+    auto bucket = m_resourceCache.find(resourceKey.GetHash());
+
+    if (bucket != m_resourceCache.end())
+    {
+        for (auto& item : bucket->second)
+        {
+            if (item.Generation == m_generation &&
+                item.Dictionary == targetDictionary &&
+                item.Theme == m_subTreeTheme &&
+                item.Key.Equals(resourceKey))
+            {
+                return &item;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 _Check_return_ CDependencyObject*
 ThemeWalkResourceCache::TryGetCachedResource(
     _In_ CResourceDictionary* targetDictionary,
@@ -57,16 +114,18 @@ ThemeWalkResourceCache::TryGetCachedResource(
 
     if (m_isCachingThemeResources)
     {
-        auto subTreeTheme = m_subTreeTheme;
-        auto iter = std::find_if(m_resourceCache.begin(), m_resourceCache.end(),
-            [&](const CacheItemType& item)
-            {
-                return (std::get<0>(item) == targetDictionary && std::get<1>(item) == subTreeTheme && std::get<2>(item).Equals(resourceKey));
-            });
+        if (CacheItem* item = FindCacheItem(targetDictionary, resourceKey))
+        {
+            resource = item->Resource.lock_noref();
+        }
 
-        if (iter != m_resourceCache.end())
+        if (resource)
         {
-            resource = std::get<3>(*iter).lock_noref();
+            ++m_statistics.Hits;
+        }
+        else
+        {
+            ++m_statistics.Misses;
         }
     }
 
@@ -82,17 +141,31 @@ ThemeWalkResourceCache::AddCachedResource(
 {
     if (m_isCachingThemeResources)
     {
-        auto subTreeTheme = m_subTreeTheme;
-        auto iter = std::find_if(m_resourceCache.begin(), m_resourceCache.end(),
-            [&](const CacheItemType& item)
-            {
-                return (std::get<0>(item) == targetDictionary && std::get<1>(item) == subTreeTheme && std::get<2>(item).Equals(resourceKey));
-            });
-
         // Only add an entry if one isn't already in there.
-        if (iter == m_resourceCache.end())
+        if (FindCacheItem(targetDictionary, resourceKey) == nullptr)
         {
-            m_resourceCache.push_back(std::make_tuple(targetDictionary, subTreeTheme, resourceKey, xref::get_weakref(resource)));
+            auto& items = m_resourceCache[resourceKey.GetHash()];
+
+            // Reuse the slot of an item from an earlier generation if there is one.
+            auto slot = std::find_if(items.begin(), items.end(),
+                [&](const CacheItem& item)
+                {
+                    return item.Generation != m_generation;
+                });
+
+            if (slot == items.end())
+            {
+                items.emplace_back();
+                slot = items.end() - 1;
+            }
+
+            slot->Dictionary = targetDictionary;
+            slot->Theme = m_subTreeTheme;
+            slot->Generation = m_generation;
+            slot->Key = resourceKey;
+            slot->Resource = xref::get_weakref(resource);
+
+            ++m_liveEntryCount;
         }
     }
 }
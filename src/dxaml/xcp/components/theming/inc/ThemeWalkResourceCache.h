@@ -17,6 +17,13 @@ namespace wil { namespace details {
 class ThemeWalkResourceCache
 {
 public:
+    struct Statistics
+    {
+        std::uint32_t Hits = 0;
+        std::uint32_t Misses = 0;
+        std::uint32_t Entries = 0;
+    };
+
     ThemeWalkResourceCache() = default;
     ThemeWalkResourceCache(const ThemeWalkResourceCache&) = delete;
     ThemeWalkResourceCache& operator=(const ThemeWalkResourceCache&) = delete;
@@ -45,16 +52,55 @@ public:
 
     bool IsEmpty() const
     {
-        return m_resourceCache.empty();
+        return m_liveEntryCount == 0;
+    }
+
+    // Counters for the caching scope currently in progress, or for the last one if none is in progress.
+    Statistics GetStatistics() const
+    {
+        Statistics statistics = m_statistics;
+
+        if (m_isCachingThemeResources)
+        {
+            statistics.Entries = m_liveEntryCount;
+        }
+
+        return statistics;
     }
 
 private:
     // We cache our resource lookups for the duration of a theme walk and clear them
     // when the walk completes.  This is done to alleviate the perf cost of querying
     // the resource dictionary multiple times for the same resource.
-    typedef std::tuple<CResourceDictionary*, Theming::Theme, xstring_ptr, xref::weakref_ptr<CDependencyObject>> CacheItemType;
+    //
+    // Items are bucketed by the hash of their resource key, and a bucket holds one item per (dictionary, theme) the
+    // key was looked up in - usually just one or two. Ending a caching scope only bumps m_generation; items from an
+    // earlier generation are treated as absent and get overwritten in place, so the buckets allocated by one walk are
+    // reused by the next instead of being freed and reallocated.
+    struct CacheItem
+    {
+        CResourceDictionary* Dictionary;
+        Theming::Theme Theme;
+        std::uint32_t Generation;
+        xstring_ptr Key;
+        xref::weakref_ptr<CDependencyObject> Resource;
+    };
+
+    typedef std::unordered_map<std::size_t, std::vector<CacheItem>> CacheType;
+
+    CacheItem* FindCacheItem(
+        _In_ CResourceDictionary* targetDictionary,
+        _In_ const xstring_ptr& resourceKey);
+
+    void EndCachingThemeResources();
+
+    // Once a walk leaves behind more buckets than this, release them rather than keeping them around for reuse.
+    static constexpr std::size_t c_maxRetainedBuckets = 4096;
 
-    std::vector<CacheItemType> m_resourceCache;
+    CacheType m_resourceCache;
+    std::uint32_t m_generation = 0;
+    std::uint32_t m_liveEntryCount = 0;
+    Statistics m_statistics;
 
     Theming::Theme m_subTreeTheme = Theming::Theme::None;
 
@@ -22,7 +22,7 @@
 #include "DOPointerCast.h"
 #include "CValueUtil.h"
 
-#include "Enums.g.h" // uses GetKnownWinRTBoxFromEnumValue, GetEnumValueFromKnownWinRTBox
+#include "Enums.g.h" // uses GetEnumValueFromKnownWinRTBox
 
 // from components
 #include "ThemeResource.h"
@@ -2303,7 +2303,7 @@ _Check_return_ HRESULT CValueBoxer::UnboxObjectValue(
             {
                 UINT nValue;
                 IFC_RETURN(UnboxEnumValue(box, pTargetType, &nValue));
-                IFC_RETURN(GetKnownWinRTBoxFromEnumValue(nValue, pTargetType, &spInspectable));
+                IFC_RETURN(StaticStore::GetEnumValue(nValue, pTargetType, &spInspectable));
             }
             else if (!pTargetType->IsBuiltinType())
             {
@@ -2388,7 +2388,7 @@ _Check_return_ HRESULT CValueBoxer::UnboxObjectValue(
                         }
                         else
                         {
-                            IFC_RETURN(GetKnownWinRTBoxFromEnumValue(nValue, boxType, &spInspectable));
+                            IFC_RETURN(StaticStore::GetEnumValue(nValue, boxType, &spInspectable));
                         }
                     }
                     else if (box->GetType() == valueSignedArray)
@@ -2651,7 +2651,7 @@ _Check_return_ HRESULT CValueBoxer::UnboxObjectValue(
                             if (pDO->OfTypeByIndex<KnownTypeIndex::Enumerated>())
                             {
                                 CEnumerated* pEnum = static_cast<CEnumerated*>(pDO);
-                                IFC_RETURN(GetKnownWinRTBoxFromEnumValue(pEnum->m_nValue, MetadataAPI::GetClassInfoByIndex(pEnum->GetEnumTypeIndex()), &spInspectable));
+                                IFC_RETURN(StaticStore::GetEnumValue(pEnum->m_nValue, MetadataAPI::GetClassInfoByIndex(pEnum->GetEnumTypeIndex()), &spInspectable));
                             }
                             else
                             {
@@ -420,7 +420,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromInt32(_In_ INT32 nValue, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreateInt32(nValue, ppValue));
+    IFC_RETURN(StaticStore::GetInt32(nValue, ppValue));
 
     return S_OK;
 }
@@ -456,7 +456,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromDouble(_In_ DOUBLE nValue, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreateDouble(nValue, ppValue));
+    IFC_RETURN(StaticStore::GetDouble(nValue, ppValue));
 
     return S_OK;
 }
@@ -474,7 +474,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromString(_In_opt_ HSTRING hString, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreateString(hString, ppValue));
+    IFC_RETURN(StaticStore::GetString(hString, ppValue));
 
     return S_OK;
 }
@@ -511,7 +511,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromPoint(_In_ wf::Point value, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreatePoint(value, ppValue));
+    IFC_RETURN(StaticStore::GetPoint(value, ppValue));
 
     return S_OK;
 }
@@ -520,7 +520,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromRect(_In_ wf::Rect value, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreateRect(value, ppValue));
+    IFC_RETURN(StaticStore::GetRect(value, ppValue));
 
     return S_OK;
 }
@@ -529,7 +529,7 @@ _Check_return_
 HRESULT
 DirectUI::PropertyValue::CreateFromSize(_In_ wf::Size value, _Outptr_ IInspectable **ppValue)
 {
-    IFC_RETURN(StaticStore::GetPropertyValueStaticsNoRef()->CreateSize(value, ppValue));
+    IFC_RETURN(StaticStore::GetSize(value, ppValue));
 
     return S_OK;
 }
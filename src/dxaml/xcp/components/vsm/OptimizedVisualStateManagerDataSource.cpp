@@ -23,6 +23,7 @@
 #include <StateTriggerCollection.h>
 #include <SetterBaseCollection.h>
 #include <ThemeResource.h>
+#include <ObjectWriterNode.h>
 
 OptimizedVisualStateManagerDataSource::OptimizedVisualStateManagerDataSource(CVisualStateGroupCollection* pGroupCollection)
     : m_objectCreator(
@@ -78,8 +79,7 @@ _Check_return_ HRESULT OptimizedVisualStateManagerDataSource::TryGetOrCreateTran
     if (customRuntimeData->TryGetVisualTransition(fromIndex, toIndex, &transitionToken))
     {
         std::shared_ptr<CDependencyObject> transition;
-        xref_ptr<CThemeResource> unused;
-        IFC_RETURN(m_objectCreator.CreateInstance(transitionToken, &transition, &unused));
+        IFC_RETURN(CreateFromSharedNodes(transitionToken, &transition));
         *pTransition = std::static_pointer_cast<CVisualTransition>(transition);
     }
     else
@@ -97,8 +97,7 @@ _Check_return_ HRESULT OptimizedVisualStateManagerDataSource::TryGetOrCreateStor
     {
         auto storyboardToken = customRuntimeData->GetStoryboard(index);
         std::shared_ptr<CDependencyObject> storyboard;
-        xref_ptr<CThemeResource> unused;
-        IFC_RETURN(m_objectCreator.CreateInstance(storyboardToken, &storyboard, &unused));
+        IFC_RETURN(CreateFromSharedNodes(storyboardToken, &storyboard));
         *pStoryboard = std::static_pointer_cast<CStoryboard>(storyboard);
     }
     else
@@ -108,6 +107,33 @@ _Check_return_ HRESULT OptimizedVisualStateManagerDataSource::TryGetOrCreateStor
     return S_OK;
 }
 
+// Creates this control's instance of a Storyboard or VisualTransition from the nodes that all the
+// controls sharing the runtime data decoded. TargetName is only resolved once the instance starts.
+_Check_return_ HRESULT OptimizedVisualStateManagerDataSource::CreateFromSharedNodes(_In_ StreamOffsetToken token, _Out_ std::shared_ptr<CDependencyObject>* pResult)
+{
+    auto& nodes = m_pGroupCollection->GetCustomRuntimeData()->GetDecodedNodes(token);
+
+    if (!nodes)
+    {
+        auto decodedNodes = std::make_shared<std::vector<ObjectWriterNode>>();
+        IFC_RETURN(m_objectCreator.DecodeNodes(token, decodedNodes.get()));
+        nodes = std::move(decodedNodes);
+    }
+
+    xref_ptr<CThemeResource> unused;
+
+    if (nodes->empty())
+    {
+        IFC_RETURN(m_objectCreator.CreateInstance(token, pResult, &unused));
+    }
+    else
+    {
+        IFC_RETURN(m_objectCreator.CreateInstance(*nodes, pResult, &unused));
+    }
+
+    return S_OK;
+}
+
 _Check_return_ HRESULT OptimizedVisualStateManagerDataSource::TryGetOrCreatePropertySettersForVisualStateImpl(_In_ int index, _Out_ std::vector<std::shared_ptr<CSetter>>* pSetterVector)
 {
     std::vector<std::shared_ptr<CSetter>> setterVector;
@@ -51,6 +51,7 @@ protected:
 
 private:
     CustomWriterRuntimeObjectCreator m_objectCreator;
+    _Check_return_ HRESULT CreateFromSharedNodes(_In_ StreamOffsetToken token, _Out_ std::shared_ptr<CDependencyObject>* pResult);
     _Check_return_ HRESULT GetQualifiersFromStateTriggerTokens(int index, OnQualifierCreatedCallback onQualifierCreated);
     _Check_return_ HRESULT GetQualifiersFromStateTriggerValues(int index, OnQualifierCreatedCallback onQualifierCreated);
     _Check_return_ HRESULT GetQualifiersFromStaticResourceTriggerTokens(int index, OnQualifierCreatedCallback onCreated);
@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+
+#include <XStringInternTable.h>
+#include <XcpAllocation.h>
+#include <atomic>
+#include <wil\resource.h>
+
+namespace
+{
+    constexpr XUINT32 c_bucketCount = 4096;
+    constexpr XUINT32 c_maxEntryCount = 32768;
+    constexpr XUINT32 c_maxInternedLength = 128;
+
+    // Entries don't change once they're published, so they can be read without the lock.
+    struct Entry
+    {
+        Entry(xstring_ptr&& string, std::size_t hash, _In_opt_ const Entry* pNext)
+            : String(std::move(string))
+            , Hash(hash)
+            , pNext(pNext)
+        {}
+
+        const xstring_ptr String;
+        const std::size_t Hash;
+        const Entry* const pNext;
+    };
+
+    std::atomic<const Entry*> s_buckets[c_bucketCount] = {};
+
+    SRWLOCK s_insertLock = SRWLOCK_INIT;
+    XUINT32 s_entryCount = 0;
+
+    volatile LONG s_hitCount = 0;
+    volatile LONG s_missCount = 0;
+    volatile LONG64 s_bytesSaved = 0;
+
+    const Entry* Find(_In_ const xstring_ptr_view& strString, std::size_t hash)
+    {
+        for (const Entry* pEntry = s_buckets[hash % c_bucketCount].load(std::memory_order_acquire); pEntry; pEntry = pEntry->pNext)
+        {
+            if (pEntry->Hash == hash && pEntry->String.Equals(strString))
+            {
+                return pEntry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void RecordHit(_In_ const xstring_ptr_view& strString, _In_ const Entry* pEntry)
+    {
+        InterlockedIncrement(&s_hitCount);
+
+        // A string that's already backed by the canonical storage didn't cost anything extra.
+        if (strString.GetBuffer() != pEntry->String.GetBuffer())
+        {
+            InterlockedAdd64(&s_bytesSaved, (strString.GetCount() + 1) * sizeof(WCHAR));
+        }
+    }
+}
+
+_Check_return_ HRESULT XStringInternTable::Intern(
+    _In_ const xstring_ptr_view& strString,
+    _Out_ xstring_ptr* pstrInterned,
+    _Out_opt_ std::size_t* pHash)
+{
+    const std::size_t hash = strString.GetHash();
+
+    if (pHash)
+    {
+        *pHash = hash;
+    }
+
+    if (strString.IsNullOrEmpty() || strString.GetCount() > c_maxInternedLength)
+    {
+        IFC_RETURN(strString.Promote(pstrInterned));
+        return S_OK;
+    }
+
+    const Entry* pEntry = Find(strString, hash);
+
+    if (!pEntry)
+    {
+        auto lock = wil::AcquireSRWLockExclusive(&s_insertLock);
+
+        // Someone else may have added it while we were waiting for the lock.
+        pEntry = Find(strString, hash);
+
+        if (!pEntry)
+        {
+            xstring_ptr strCanonical;
+            IFC_RETURN(strString.Promote(&strCanonical));
+
+            if (s_entryCount < c_maxEntryCount)
+            {
+                auto& bucket = s_buckets[hash % c_bucketCount];
+
+                // Interned strings live as long as the process, keep them out of the leak report.
+                XcpAllocation::LeakIgnoringAllocator<Entry> allocator;
+                Entry* pNewEntry = new (allocator.allocate(1)) Entry(std::move(strCanonical), hash, bucket.load(std::memory_order_relaxed));
+
+                bucket.store(pNewEntry, std::memory_order_release);
+                ++s_entryCount;
+
+                *pstrInterned = pNewEntry->String;
+            }
+            else
+            {
+                *pstrInterned = std::move(strCanonical);
+            }
+
+            InterlockedIncrement(&s_missCount);
+            return S_OK;
+        }
+    }
+
+    RecordHit(strString, pEntry);
+    *pstrInterned = pEntry->String;
+
+    return S_OK;
+}
+
+XStringInternTable::Statistics XStringInternTable::GetStatistics()
+{
+    Statistics statistics = {};
+
+    {
+        auto lock = wil::AcquireSRWLockShared(&s_insertLock);
+        statistics.EntryCount = s_entryCount;
+    }
+
+    statistics.HitCount = static_cast<XUINT32>(s_hitCount);
+    statistics.MissCount = static_cast<XUINT32>(s_missCount);
+    statistics.BytesSaved = static_cast<XUINT64>(s_bytesSaved);
+
+    return statistics;
+}
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <xstring_ptr.h>
+
+// Process-wide table of canonical copies of the strings the parser, the resource dictionaries and
+// the namescopes see over and over, like type and property names, resource keys and element names.
+// Copies of an interned string share its storage, so comparing two of them stops at the storage
+// pointer (see xstring_ptr_view::Compare), and only one copy of each string is kept alive.
+//
+// Lookups don't take a lock, and entries are only ever added. Interned strings stay alive until the
+// process exits, so the table only takes short strings, and stops taking new ones once it's full.
+namespace XStringInternTable
+{
+    struct Statistics
+    {
+        XUINT32 EntryCount;
+        XUINT32 HitCount;
+        XUINT32 MissCount;
+        XUINT64 BytesSaved;     // Character storage of the copies that hits made unnecessary.
+    };
+
+    // Returns the canonical copy of the string, and its xstring_ptr_view::GetHash. Strings the
+    // table doesn't take come back as a regular copy.
+    _Check_return_ HRESULT Intern(
+        _In_ const xstring_ptr_view& strString,
+        _Out_ xstring_ptr* pstrInterned,
+        _Out_opt_ std::size_t* pHash = nullptr);
+
+    Statistics GetStatistics();
+}
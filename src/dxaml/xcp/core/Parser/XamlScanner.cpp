@@ -10,6 +10,7 @@
 #include "ReaderString.h"
 #include "XamlUnknownXmlNamespace.h"
 #include <WinReader.h>
+#include <XStringInternTable.h>
 
 // Initializes a new instance of the XamlScanner class.  It takes the same
 // XamlParserContext used to initialize the XamlPullParser (which the two share
@@ -687,7 +688,7 @@ _Check_return_ HRESULT XamlScanner::ReadPrefix(_Out_ xstring_ptr* pstrOutPrefix)
     }
     else
     {
-        IFC_RETURN(xstring_ptr::CloneBuffer(prefix, prefix.length(), pstrOutPrefix));
+        IFC_RETURN(XStringInternTable::Intern(XSTRING_PTR_EPHEMERAL2(prefix, prefix.length()), pstrOutPrefix));
     }
 
     return S_OK;
@@ -700,7 +701,8 @@ _Check_return_ HRESULT XamlScanner::ReadLocalName(_Out_ xstring_ptr* pstrOutLoca
     // We don't own the buffer we get back here.
     IFC_RETURN(m_XmlReader->GetLocalName(&localName));
     // Assumes you always read the line/col with the prefix.
-    IFC_RETURN(xstring_ptr::CloneBuffer(localName, localName.length(), pstrOutLocalName));
+    // Element and attribute names come from a small vocabulary, so share one copy of each.
+    IFC_RETURN(XStringInternTable::Intern(XSTRING_PTR_EPHEMERAL2(localName, localName.length()), pstrOutLocalName));
 
     return S_OK;
 }
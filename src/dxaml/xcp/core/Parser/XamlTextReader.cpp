@@ -7,6 +7,10 @@
 
 #include "precomp.h"
 #include <WinReader.h>
+#include <RuntimeEnabledFeatures.h>
+
+// Smaller documents are done tokenizing before handing them to another thread would pay off.
+static constexpr XUINT32 c_minPipelinedSourceSize = 32 * 1024;
 
 XamlTextReader::~XamlTextReader()
 {
@@ -32,8 +36,12 @@ XamlTextReader::Create(
     // it off before we begin parsing
     IFC_RETURN(StripLeadingWhitespaceForXmlLiteParser(cSource, pSource, &cSource, &pSource));
 
+    const bool isPipelined =
+        cSource >= c_minPipelinedSourceSize &&
+        RuntimeFeatureBehavior::GetRuntimeEnabledFeatureDetector()->IsFeatureEnabled(RuntimeFeatureBehavior::RuntimeEnabledFeature::PipelineXamlTextParsing);
+
     auto reader = XmlReaderWrapper::CreateLegacyXmlReaderWrapper();
-    IFC_RETURN(reader->SetInput(cSource, pSource, textReaderSettings.get_IsUtf16Encoded()));
+    IFC_RETURN(reader->SetInput(cSource, pSource, textReaderSettings.get_IsUtf16Encoded(), isPipelined));
 
     std::shared_ptr<XamlParserContext> spParserContext;
     IFC_RETURN(XamlParserContext::Create(spXamlSchemaContext, spParserContext));
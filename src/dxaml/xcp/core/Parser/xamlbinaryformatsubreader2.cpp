@@ -668,8 +668,8 @@ void XamlBinaryFormatSubReader2::ReadNamespace(
 
 std::shared_ptr<XamlQualifiedObject> XamlBinaryFormatSubReader2::ReadConstantAsQO()
 {
-    // Note we're using this perallocated XQO...
-    auto returnQO = m_spTemporaryValue;
+    // Note we're using this perallocated XQO, unless the caller keeps the nodes...
+    auto returnQO = m_reuseConstantValue ? m_spTemporaryValue : std::make_shared<XamlQualifiedObject>();
     CValue value = ReadCValue();
     THROW_IF_FAILED(returnQO->SetValue(value));
     return returnQO;
@@ -0,0 +1,432 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "GeometryHitTestCache.h"
+
+void HitTestEdgeList::BeginPiece()
+{
+    ++m_pieceCount;
+}
+
+void HitTestEdgeList::AddEdge(_In_ const XPOINTF& from, _In_ const XPOINTF& to)
+{
+    m_edges.push_back({ from, to, m_pieceCount });
+}
+
+void HitTestEdgeList::Build(_In_ XFLOAT tolerance)
+{
+    m_tolerance = tolerance;
+    m_edges.shrink_to_fit();
+
+    if (m_edges.empty())
+    {
+        m_bandCount = 0;
+        return;
+    }
+
+    XFLOAT top = XFLOAT_MAX;
+    XFLOAT bottom = -XFLOAT_MAX;
+    XFLOAT right = -XFLOAT_MAX;
+
+    for (const Edge& edge : m_edges)
+    {
+        top = std::min({ top, edge.From.y, edge.To.y });
+        bottom = std::max({ bottom, edge.From.y, edge.To.y });
+        right = std::max({ right, edge.From.x, edge.To.x });
+    }
+
+    m_top = top - tolerance;
+    m_bottom = bottom + tolerance;
+    m_right = right + tolerance;
+
+    const XUINT32 edgeCount = static_cast<XUINT32>(m_edges.size());
+    const XFLOAT height = m_bottom - m_top;
+
+    m_bandCount = std::min(std::max(edgeCount / c_edgesPerBand, 1u), c_maxBandCount);
+
+    if (!(height > 0.0f) || !IsFiniteF(height))
+    {
+        m_bandCount = 1;
+    }
+
+    // Fewer bands when the edges are long compared to the bands, a single band is
+    // the same as testing every edge.
+    for (;;)
+    {
+        m_bandScale = (m_bandCount > 1) ? m_bandCount / height : 0.0f;
+
+        m_bandStarts.assign(m_bandCount + 1, 0);
+
+        XUINT32 entryCount = 0;
+        for (const Edge& edge : m_edges)
+        {
+            const XUINT32 first = GetBand(std::min(edge.From.y, edge.To.y) - tolerance);
+            const XUINT32 last = GetBand(std::max(edge.From.y, edge.To.y) + tolerance);
+
+            for (XUINT32 band = first; band <= last; ++band)
+            {
+                ++m_bandStarts[band + 1];
+            }
+
+            entryCount += last - first + 1;
+        }
+
+        if (m_bandCount == 1 || entryCount <= edgeCount * c_maxBandsPerEdge)
+        {
+            for (XUINT32 band = 0; band < m_bandCount; ++band)
+            {
+                m_bandStarts[band + 1] += m_bandStarts[band];
+            }
+
+            m_bandEdges.resize(entryCount);
+            break;
+        }
+
+        m_bandCount /= 2;
+    }
+
+    std::vector<XUINT32> next(m_bandStarts.begin(), m_bandStarts.end() - 1);
+
+    for (XUINT32 i = 0; i < edgeCount; ++i)
+    {
+        const Edge& edge = m_edges[i];
+        const XUINT32 first = GetBand(std::min(edge.From.y, edge.To.y) - tolerance);
+        const XUINT32 last = GetBand(std::max(edge.From.y, edge.To.y) + tolerance);
+
+        for (XUINT32 band = first; band <= last; ++band)
+        {
+            m_bandEdges[next[band]++] = i;
+        }
+    }
+}
+
+XINT32 HitTestEdgeList::GetWindingNumber(_In_ const XPOINTF& point, _Out_ bool* pIsNearEdge) const
+{
+    const XUINT32* pBegin = nullptr;
+    const XUINT32* pEnd = nullptr;
+    XINT32 windingNumber = 0;
+    bool isNearEdge = false;
+
+    if (GetBandEdges(point, &pBegin, &pEnd))
+    {
+        for (const XUINT32* pIndex = pBegin; pIndex != pEnd; ++pIndex)
+        {
+            isNearEdge = TestEdge(m_edges[*pIndex], point, &windingNumber) || isNearEdge;
+        }
+    }
+
+    *pIsNearEdge = isNearEdge;
+    return windingNumber;
+}
+
+bool HitTestEdgeList::IsInsideAnyPiece(_In_ const XPOINTF& point, _Out_ bool* pIsNearEdge) const
+{
+    const XUINT32* pBegin = nullptr;
+    const XUINT32* pEnd = nullptr;
+    bool isInside = false;
+    bool isNearEdge = false;
+
+    if (GetBandEdges(point, &pBegin, &pEnd))
+    {
+        // The edges of a piece are next to each other, so the winding number of each
+        // piece is complete by the time the next piece starts.
+        XUINT32 piece = 0;
+        XINT32 windingNumber = 0;
+
+        for (const XUINT32* pIndex = pBegin; pIndex != pEnd && !isInside; ++pIndex)
+        {
+            const Edge& edge = m_edges[*pIndex];
+
+            if (edge.Piece != piece)
+            {
+                isInside = (windingNumber != 0);
+                piece = edge.Piece;
+                windingNumber = 0;
+            }
+
+            isNearEdge = TestEdge(edge, point, &windingNumber) || isNearEdge;
+        }
+
+        isInside = isInside || (windingNumber != 0);
+    }
+
+    *pIsNearEdge = isNearEdge;
+    return isInside;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Adds the crossing of the edge with the ray going right from the point
+//      to the winding number, and returns whether the edge is within
+//      tolerance of the point. This is the math of PointHitTestHelper, with
+//      the point moved to the origin.
+//
+//------------------------------------------------------------------------
+bool HitTestEdgeList::TestEdge(_In_ const Edge& edge, _In_ const XPOINTF& point, _Inout_ XINT32* pWindingNumber) const
+{
+    const XPOINTF from = edge.From - point;
+    const XPOINTF to = edge.To - point;
+
+    if (from.y > 0)
+    {
+        if (to.y <= 0 && from.x * to.y - to.x * from.y >= 0)
+        {
+            --(*pWindingNumber);
+        }
+    }
+    else
+    {
+        if (to.y > 0 && to.x * from.y - from.x * to.y >= 0)
+        {
+            ++(*pWindingNumber);
+        }
+    }
+
+    const XDOUBLE squaredThreshold = m_tolerance * m_tolerance;
+
+    if (to * to < squaredThreshold)
+    {
+        return true;
+    }
+
+    const XPOINTF vec = to - from;
+    const XFLOAT r = vec * vec;
+    const XFLOAT t = -(from * vec);
+
+    if (0 <= t && t <= r)
+    {
+        const XPOINTF Pr = from * r + vec * t;
+
+        return Pr * Pr < squaredThreshold * r * r;
+    }
+
+    return false;
+}
+
+bool HitTestEdgeList::GetBandEdges(_In_ const XPOINTF& point, _Out_ const XUINT32** ppBegin, _Out_ const XUINT32** ppEnd) const
+{
+    *ppBegin = nullptr;
+    *ppEnd = nullptr;
+
+    // Nothing to the right of the point can cross its ray, and nothing is near it.
+    if (m_bandCount == 0 || !(point.y >= m_top && point.y <= m_bottom && point.x <= m_right))
+    {
+        return false;
+    }
+
+    const XUINT32 band = GetBand(point.y);
+
+    *ppBegin = m_bandEdges.data() + m_bandStarts[band];
+    *ppEnd = m_bandEdges.data() + m_bandStarts[band + 1];
+
+    return true;
+}
+
+XUINT32 HitTestEdgeList::GetBand(_In_ XFLOAT y) const
+{
+    const XFLOAT band = (y - m_top) * m_bandScale;
+
+    if (!(band > 0.0f))
+    {
+        return 0;
+    }
+
+    return std::min(static_cast<XUINT32>(std::min(band, static_cast<XFLOAT>(m_bandCount))), m_bandCount - 1);
+}
+
+const HitTestEdgeList* GeometryHitTestCache::GetFillEdges(
+    _In_opt_ const CMILMatrix* pTransform,
+    _Out_ GeometryFillMode* pFillMode) const
+{
+    *pFillMode = GeometryFillMode::Alternate;
+
+    if (m_fill && m_fill->IsBuilt && AreTransformsEqual(m_fill->HasTransform, m_fill->Transform, pTransform))
+    {
+        *pFillMode = m_fill->FillMode;
+        return &m_fill->Edges;
+    }
+
+    return nullptr;
+}
+
+const HitTestEdgeList* GeometryHitTestCache::GetStrokeEdges(
+    _In_ const CPlainPen& pen,
+    _In_opt_ const CMILMatrix* pTransform) const
+{
+    if (m_stroke && m_stroke->IsBuilt &&
+        AreTransformsEqual(m_stroke->HasTransform, m_stroke->Transform, pTransform) &&
+        ArePensEqual(m_stroke->Pen, pen))
+    {
+        return &m_stroke->Edges;
+    }
+
+    return nullptr;
+}
+
+HitTestEdgeList* GeometryHitTestCache::BeginFillEdges(_In_opt_ const CMILMatrix* pTransform)
+{
+    m_fill = std::make_unique<FillEntry>();
+    m_fill->HasTransform = (pTransform != nullptr);
+    m_fill->Transform = pTransform ? *pTransform : CMILMatrix(true);
+
+    return &m_fill->Edges;
+}
+
+const HitTestEdgeList* GeometryHitTestCache::EndFillEdges(_In_ GeometryFillMode fillMode)
+{
+    m_fill->FillMode = fillMode;
+    m_fill->Edges.Build(c_tolerance);
+    m_fill->IsBuilt = true;
+
+    return &m_fill->Edges;
+}
+
+HitTestEdgeList* GeometryHitTestCache::BeginStrokeEdges(
+    _In_ const CPlainPen& pen,
+    _In_opt_ const CMILMatrix* pTransform)
+{
+    m_stroke = std::make_unique<StrokeEntry>(pen);
+    m_stroke->HasTransform = (pTransform != nullptr);
+    m_stroke->Transform = pTransform ? *pTransform : CMILMatrix(true);
+
+    return &m_stroke->Edges;
+}
+
+const HitTestEdgeList* GeometryHitTestCache::EndStrokeEdges()
+{
+    m_stroke->Edges.Build(c_tolerance);
+    m_stroke->IsBuilt = true;
+
+    return &m_stroke->Edges;
+}
+
+bool GeometryHitTestCache::AreTransformsEqual(
+    bool hasTransform,
+    _In_ const CMILMatrix& transform,
+    _In_opt_ const CMILMatrix* pTransform)
+{
+    return hasTransform ? (pTransform != nullptr && transform == *pTransform) : (pTransform == nullptr);
+}
+
+bool GeometryHitTestCache::ArePensEqual(_In_ const CPlainPen& pen, _In_ const CPlainPen& other)
+{
+    if (pen.GetWidth() != other.GetWidth() ||
+        pen.GetHeight() != other.GetHeight() ||
+        pen.GetAngle() != other.GetAngle() ||
+        pen.GetStartCap() != other.GetStartCap() ||
+        pen.GetEndCap() != other.GetEndCap() ||
+        pen.GetDashCap() != other.GetDashCap() ||
+        pen.GetJoin() != other.GetJoin() ||
+        pen.GetMiterLimit() != other.GetMiterLimit() ||
+        pen.GetDashStyle() != other.GetDashStyle() ||
+        pen.GetDashOffset() != other.GetDashOffset() ||
+        pen.GetDashCount() != other.GetDashCount())
+    {
+        return false;
+    }
+
+    for (XUINT32 i = 0; i < pen.GetDashCount(); ++i)
+    {
+        if (pen.GetDash(i) != other.GetDash(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      (ctor) - Create a new helper recording into the edge list.
+//
+//------------------------------------------------------------------------
+EdgeRecordingHitTestHelper::EdgeRecordingHitTestHelper(
+    _In_ HitTestEdgeList& edges,
+    XFLOAT tolerance,
+    _In_opt_ const CMILMatrix* pTransform
+    )
+    : HitTestHelper(tolerance, pTransform)
+    , m_edges(edges)
+{
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Record the edge to the new point.
+//
+//------------------------------------------------------------------------
+void
+EdgeRecordingHitTestHelper::AcceptPoint(
+    _In_ const XPOINTF& endPoint
+    )
+{
+    CheckForNaN(endPoint);
+
+    m_edges.AddEdge(m_currentPoint, endPoint);
+
+    m_currentPoint = endPoint;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Nothing is hit while recording, so widening never stops early.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+EdgeRecordingHitTestHelper::GetResult(bool *pWasHit)
+{
+    *pWasHit = false;
+
+    return S_OK;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Start a new piece.
+//
+//------------------------------------------------------------------------
+void
+EdgeRecordingHitTestHelper::Reset()
+{
+    m_edges.BeginPiece();
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      (ctor) - Create a new sink recording the flattened fill.
+//
+//------------------------------------------------------------------------
+EdgeRecordingGeometrySink::EdgeRecordingGeometrySink(
+    _In_ HitTestEdgeList& edges,
+    XFLOAT tolerance,
+    _In_opt_ const CMILMatrix* pTransform
+    )
+    : HitTestGeometrySink()
+    , m_hitTestHelper(edges, tolerance, pTransform)
+{
+    m_pBaseHitTestHelper = &m_hitTestHelper;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Nothing is hit while recording.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+EdgeRecordingGeometrySink::GetResult(
+    _Out_ bool* pHit
+    )
+{
+    *pHit = false;
+
+    return S_OK;
+}
@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "PackedPathGeometry.h"
+
+void PackedPathGeometry::OpenFigure(_In_ XINT32 flags, _In_ const XPOINTF& point)
+{
+    AddVerb(Verb::OpenFigure, flags);
+    AddPoints(&point, 1);
+}
+
+void PackedPathGeometry::CloseFigure()
+{
+    AddVerb(Verb::CloseFigure, 0);
+}
+
+void PackedPathGeometry::AddLine(_In_ XINT32 flags, _In_ const XPOINTF& point)
+{
+    AddVerb(Verb::AddLine, flags);
+    AddPoints(&point, 1);
+}
+
+void PackedPathGeometry::AddBezier(_In_ XINT32 flags, _In_reads_(3) const XPOINTF* pPoints)
+{
+    AddVerb(Verb::AddBezier, flags);
+    AddPoints(pPoints, 3);
+}
+
+void PackedPathGeometry::AddQuadratic(_In_ XINT32 flags, _In_reads_(2) const XPOINTF* pPoints)
+{
+    AddVerb(Verb::AddQuadratic, flags);
+    AddPoints(pPoints, 2);
+}
+
+void PackedPathGeometry::AddArc(
+    _In_ XINT32 flags,
+    _In_reads_(2) const XPOINTF* pPoints,
+    _In_ XFLOAT angle,
+    _In_ XINT32 isLarge,
+    _In_ XINT32 isClockwise)
+{
+    AddVerb(Verb::AddArc, flags);
+    AddPoints(pPoints, 2);
+    m_values.push_back(angle);
+    m_values.push_back(isLarge ? 1.0f : 0.0f);
+    m_values.push_back(isClockwise ? 1.0f : 0.0f);
+}
+
+void PackedPathGeometry::AddSmoothBezier(_In_ XINT32 flags, _In_reads_(2) const XPOINTF* pPoints)
+{
+    AddVerb(Verb::AddSmoothBezier, flags);
+    AddPoints(pPoints, 2);
+}
+
+void PackedPathGeometry::AddSmoothQuadratic(_In_ XINT32 flags, _In_ const XPOINTF& point)
+{
+    AddVerb(Verb::AddSmoothQuadratic, flags);
+    AddPoints(&point, 1);
+}
+
+void PackedPathGeometry::SetFillMode(_In_ XcpFillMode fillMode)
+{
+    m_fillMode = fillMode;
+    m_hasFillMode = true;
+}
+
+void PackedPathGeometry::Compact()
+{
+    m_verbs.shrink_to_fit();
+    m_values.shrink_to_fit();
+}
+
+void PackedPathGeometry::AddVerb(_In_ Verb verb, _In_ XINT32 flags)
+{
+    ASSERT(flags >= 0 && flags <= UINT8_MAX);
+
+    m_verbs.push_back(static_cast<uint8_t>(verb));
+    m_verbs.push_back(static_cast<uint8_t>(flags));
+}
+
+void PackedPathGeometry::AddPoints(_In_reads_(count) const XPOINTF* pPoints, _In_ XUINT32 count)
+{
+    for (XUINT32 i = 0; i < count; ++i)
+    {
+        m_values.push_back(pPoints[i].x);
+        m_values.push_back(pPoints[i].y);
+    }
+}
+
+_Check_return_ HRESULT PackedPathGeometry::Replay(_In_ CGeometryBuilder* pBuilder) const
+{
+    const XFLOAT* pValue = m_values.data();
+    XPOINTF points[3];
+
+    auto readPoints = [&pValue, &points](XUINT32 first, XUINT32 count)
+    {
+        for (XUINT32 i = first; i < first + count; ++i)
+        {
+            points[i].x = *pValue++;
+            points[i].y = *pValue++;
+        }
+    };
+
+    for (size_t i = 0; i < m_verbs.size(); i += 2)
+    {
+        const XINT32 flags = m_verbs[i + 1];
+
+        switch (static_cast<Verb>(m_verbs[i]))
+        {
+        case Verb::OpenFigure:
+            readPoints(0, 1);
+            IFC_RETURN(pBuilder->OpenFigure(flags, points));
+            break;
+
+        case Verb::CloseFigure:
+            IFC_RETURN(pBuilder->CloseFigure());
+            break;
+
+        case Verb::AddLine:
+            readPoints(0, 1);
+            IFC_RETURN(pBuilder->AddLine(flags, points));
+            break;
+
+        case Verb::AddBezier:
+            readPoints(0, 3);
+            IFC_RETURN(pBuilder->AddBezier(flags, points));
+            break;
+
+        case Verb::AddQuadratic:
+            readPoints(0, 2);
+            IFC_RETURN(pBuilder->AddQuadratic(flags, points));
+            break;
+
+        case Verb::AddArc:
+        {
+            readPoints(0, 2);
+            const XFLOAT angle = *pValue++;
+            const XINT32 isLarge = (*pValue++ != 0.0f);
+            const XINT32 isClockwise = (*pValue++ != 0.0f);
+            IFC_RETURN(pBuilder->AddArc(flags, points, angle, isLarge, isClockwise));
+            break;
+        }
+
+        case Verb::AddSmoothBezier:
+            readPoints(1, 2);
+            IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeBezier, &points[0]));
+            IFC_RETURN(pBuilder->AddBezier(flags, points));
+            break;
+
+        case Verb::AddSmoothQuadratic:
+            readPoints(1, 1);
+            IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeQuadratic, &points[0]));
+            IFC_RETURN(pBuilder->AddQuadratic(flags, points));
+            break;
+
+        default:
+            IFC_RETURN(E_UNEXPECTED);
+        }
+    }
+
+    ASSERT(pValue == m_values.data() + m_values.size());
+
+    return S_OK;
+}
+
+std::shared_ptr<const PackedPathGeometry> PathGeometryParseCache::Find(
+    _In_ XUINT32 cString,
+    _In_reads_(cString) const WCHAR* pString) const
+{
+    if (cString == 0 || cString > c_maxCachedStringLength)
+    {
+        return nullptr;
+    }
+
+    auto itr = m_entries.find(std::wstring(pString, cString));
+    return (itr != m_entries.end()) ? itr->second : nullptr;
+}
+
+void PathGeometryParseCache::Add(
+    _In_ XUINT32 cString,
+    _In_reads_(cString) const WCHAR* pString,
+    _In_ std::shared_ptr<const PackedPathGeometry> geometry)
+{
+    if (cString == 0 || cString > c_maxCachedStringLength)
+    {
+        return;
+    }
+
+    // Apps only use a few hundred distinct strings. Going past the limit means strings are
+    // being generated, so start over rather than keeping them around.
+    if (m_entries.size() >= c_maxEntries)
+    {
+        m_entries.clear();
+    }
+
+    m_entries.emplace(std::wstring(pString, cString), std::move(geometry));
+}
@@ -17,6 +17,7 @@
 #include "resources\inc\ResourceResolver.h"
 #include "resources\inc\ScopedResources.h"
 #include "resources\inc\ResourceLookupLogger.h"
+#include "resources\inc\ResourceResolutionCache.h"
 #include <UriXStringGetters.h>
 
 #include "XamlNativeRuntime.h"
@@ -58,6 +59,7 @@ CResourceDictionary::CResourceDictionary(_In_ CCoreServices* pCore)
     , m_isHighContrast(false)
     , m_useAppResourcesForThemeRef(false)
     , m_isGlobal(false)
+    , m_version(Resources::ResourceResolutionCache::NextDictionaryVersion())
 #if DBG
     , m_processingBulkUndeferral(false)
 #endif
@@ -315,6 +317,10 @@ CResourceDictionary::AddKey(
     {
         // Adding a key should invalidate all not-found caches on the path.
         InvalidateNotFoundCache(true, key);
+
+        // Undeferring a key doesn't change what a lookup resolves to, so only keys that are actually new affect
+        // memoized lookups.
+        IncrementVersion();
     }
 
     return S_OK;
@@ -329,6 +335,7 @@ CResourceDictionary::RemoveKey(
     CDependencyObject* pValue = nullptr;
 
     GetContext()->GetThemeWalkResourceCache()->RemoveThemeResourceCacheEntry(key.GetKey());
+    IncrementVersion();
 
     // This method is called from Remove/RemoveAt and by now all the remaining keys should
     // have been faulted in and the deferred resource dictionary released.
@@ -397,6 +404,9 @@ CResourceDictionary::GetKeyNoRefImpl(
     });
     IFC_RETURN(loggerNoRef->OnEnterDictionary(this, key.GetKey()));
 
+    // Every dictionary we enter is part of the resolution path of the lookup being memoized, if any.
+    GetContext()->GetResourceResolutionCache()->OnEnterDictionary(this);
+
     ResourceKey modifiedKey(key);
 
     // We can only use key-not-found cache optimizations if we can guarantee that the cache is valid.
@@ -511,6 +521,64 @@ CResourceDictionary::GetKeyNoRefImpl(
     return S_OK;
 }
 
+//------------------------------------------------------------------------
+//
+//  Method:   GetKeyNoRefCached
+//
+//  Synopsis:  Front end of the public lookup methods. Consults the
+//  ResourceResolutionCache before walking this dictionary and everything
+//  it defers to, and memoizes the result of the walk together with the
+//  versions of every dictionary that was entered.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CResourceDictionary::GetKeyNoRefCached(
+    const ResourceKey& key,
+    Resources::LookupScope scope,
+    _Outptr_ CDependencyObject** keyNoRef,
+    _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom)
+{
+    auto core = GetContext();
+    Resources::ResourceResolutionCache* cacheNoRef = core->GetResourceResolutionCache();
+
+    // SelfOnly lookups are already a single hash lookup. Lookups nested inside a lookup that is being recorded (e.g.
+    // resources referenced by a deferred resource as it is faulted in) contribute to the outer recording instead, and
+    // traced lookups need to take the real path so the trace is meaningful.
+    if (scope == Resources::LookupScope::SelfOnly ||
+        cacheNoRef->IsRecording() ||
+        core->GetResourceLookupLogger()->IsLogging())
+    {
+        return GetKeyNoRefImpl(key, scope, keyNoRef, dictionaryReadFrom);
+    }
+
+    const Theme theme = Resources::ResourceResolutionCache::GetEffectiveTheme(core);
+
+    if (cacheNoRef->TryGet(core, this, key, scope, theme, keyNoRef, dictionaryReadFrom))
+    {
+        return S_OK;
+    }
+
+    xref_ptr<CResourceDictionary> readFrom;
+
+    cacheNoRef->BeginRecording();
+    auto abandonRecordingGuard = wil::scope_exit([&]
+    {
+        cacheNoRef->AbandonRecording();
+    });
+
+    IFC_RETURN(GetKeyNoRefImpl(key, scope, keyNoRef, &readFrom));
+
+    abandonRecordingGuard.release();
+    cacheNoRef->CommitRecording(this, key, scope, theme, *keyNoRef, readFrom.get());
+
+    if (dictionaryReadFrom && *keyNoRef)
+    {
+        *dictionaryReadFrom = std::move(readFrom);
+    }
+
+    return S_OK;
+}
+
 _Check_return_ HRESULT CResourceDictionary::FindDeferredResource(
     const ResourceKey& key,
     _Out_ bool& undeferring,
@@ -566,7 +634,7 @@ CResourceDictionary::GetKeyNoRef(
     _Outptr_ CDependencyObject** keyNoRef)
 {
     *keyNoRef = nullptr;
-    return GetKeyNoRefImpl(ResourceKey(strKey, false), scope, keyNoRef);
+    return GetKeyNoRefCached(ResourceKey(strKey, false), scope, keyNoRef);
 }
 
 _Check_return_ HRESULT
@@ -575,7 +643,7 @@ CResourceDictionary::GetKeyNoRef(
     _Outptr_ CDependencyObject** keyNoRef)
 {
     *keyNoRef = nullptr;
-    return GetKeyNoRefImpl(ResourceKey(strKey, false), Resources::LookupScope::All, keyNoRef);
+    return GetKeyNoRefCached(ResourceKey(strKey, false), Resources::LookupScope::All, keyNoRef);
 }
 
 _Check_return_ HRESULT
@@ -592,7 +660,7 @@ CResourceDictionary::GetImplicitStyleKeyNoRef(
         dictionaryReadFrom->reset();
     }
 
-    return GetKeyNoRefImpl(ResourceKey(strKey, true), resourceLookupScope, keyNoRef, dictionaryReadFrom);
+    return GetKeyNoRefCached(ResourceKey(strKey, true), resourceLookupScope, keyNoRef, dictionaryReadFrom);
 }
 
 _Check_return_ HRESULT CResourceDictionary::GetKeyForResourceResolutionNoRef(
@@ -609,7 +677,7 @@ _Check_return_ HRESULT CResourceDictionary::GetKeyForResourceResolutionNoRef(
     }
 
     // when resolving resources, the key will never be a type.
-    return GetKeyNoRefImpl(ResourceKey(resourceKey, false), resourceLookupScope, keyNoRef, dictionaryReadFrom);
+    return GetKeyNoRefCached(ResourceKey(resourceKey, false), resourceLookupScope, keyNoRef, dictionaryReadFrom);
 }
 
 _Check_return_ HRESULT CResourceDictionary::GetKeyForResourceResolutionNoRef(
@@ -626,7 +694,7 @@ _Check_return_ HRESULT CResourceDictionary::GetKeyForResourceResolutionNoRef(
     }
 
     // when resolving resources, the key will never be a type.
-    return GetKeyNoRefImpl(ResourceKey(key, false), resourceLookupScope, keyNoRef, dictionaryReadFrom);
+    return GetKeyNoRefCached(ResourceKey(key, false), resourceLookupScope, keyNoRef, dictionaryReadFrom);
 }
 
 //------------------------------------------------------------------------
@@ -806,6 +874,10 @@ _Check_return_ HRESULT CResourceDictionary::EnsureActiveThemeDictionary()
             m_activeTheme = core->IsThemeRequestedForSubTree() ? core->GetRequestedThemeForSubTree() : core->GetFrameworkTheming()->GetBaseTheme();
             m_activeTheme = m_activeTheme | core->GetFrameworkTheming()->GetHighContrastTheme();
 
+            // Lookups memoized under another theme skipped this method, so make sure they get re-resolved (and
+            // the theme switch handled below) rather than reused when that theme comes back.
+            IncrementVersion();
+
             // Make sure we re-evaluate all ThemeResource expressions inside this
             // theme dictionary first if a theme switch occurred.
             if (fThemeSwitchOccurred)
@@ -1120,6 +1192,7 @@ CResourceDictionary::Clear()
     xhr = CCollection::Clear();
     m_resourceMap.clear();
     m_keyByIndex.clear();
+    IncrementVersion();
     IFC(InvalidateImplicitStyles(NULL));
     m_pDeferredResources.reset();
 
@@ -1400,6 +1473,7 @@ CResourceDictionary::OnThemeDictionariesChanged()
         m_pActiveThemeDictionary = nullptr;
     }
     m_activeTheme = Theming::Theme::None;
+    IncrementVersion();
 
     RRETURN(S_OK);
 }
@@ -2210,6 +2284,11 @@ _Check_return_ HRESULT CResourceDictionary::NotifyThemeChangedCore(
     return S_OK;
 }
 
+void CResourceDictionary::IncrementVersion()
+{
+    m_version = Resources::ResourceResolutionCache::NextDictionaryVersion();
+}
+
 CResourceDictionary* GetParentDictionaryHelper(_In_ CResourceDictionary* current)
 {
     // Get immediate parent dictionary of the current one.  If it's contained in a collection,
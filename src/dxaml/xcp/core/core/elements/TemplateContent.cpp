@@ -13,6 +13,8 @@
 #include "XamlBinaryFormatSubReader2.h"
 #include "XamlOptimizedNodeList.h"
 #include "XamlReader.h"
+#include <XStringInternTable.h>
+#include <wil\resource.h>
 
 #undef max
 
@@ -657,8 +659,31 @@ CTemplateContent::LoadXbfVersion2(
         m_spXamlSavedContext,
         objectWriterSettings,
         spBinaryFormatObjectWriter));
+
+    if (!m_compiledNodes.empty())
+    {
+        for (const auto& node : m_compiledNodes)
+        {
+            IFC_RETURN(spBinaryFormatObjectWriter->WriteNode(node));
+        }
+
+        spRootInstance = spBinaryFormatObjectWriter->get_Result();
+        return S_OK;
+    }
+
     m_spSubReader->Reset();
 
+    // Keep the nodes of the first load after the content got optimized, they need their own
+    // constants to outlive the next read.
+    const bool compileNodes = m_bContentAlreadyOptimized;
+    std::vector<ObjectWriterNode> compiledNodes;
+
+    m_spSubReader->set_ReuseConstantValue(!compileNodes);
+    auto reuseConstantValueGuard = wil::scope_exit([this]()
+    {
+        m_spSubReader->set_ReuseConstantValue(true);
+    });
+
     unsigned int cacheIndexCount = 0;
     for (;;)
     {
@@ -677,10 +702,12 @@ CTemplateContent::LoadXbfVersion2(
                 auto optimizedNode = GenerateOptimizedNode(cacheIndexCount, node);
                 cacheIndexCount++;
                 IFC_RETURN(spBinaryFormatObjectWriter->WriteNode(optimizedNode));
+                compiledNodes.push_back(std::move(optimizedNode));
             }
             else
             {
                 IFC_RETURN(spBinaryFormatObjectWriter->WriteNode(node));
+                compiledNodes.push_back(std::move(node));
             }
         }
         else
@@ -705,6 +732,12 @@ CTemplateContent::LoadXbfVersion2(
     }
 
     spRootInstance = spBinaryFormatObjectWriter->get_Result();
+
+    if (compileNodes)
+    {
+        m_compiledNodes = std::move(compiledNodes);
+    }
+
     if (bTryOptimizeContent && !m_bContentAlreadyOptimized)
     {
         m_bContentAlreadyOptimized = true;
@@ -1097,7 +1130,7 @@ size_t CTemplateContent::GetOrCreateNameIndex(_In_ const xstring_ptr_view& strNa
     if (it == m_nameTableMap.end())
     {
         xstring_ptr promotedName;
-        IFCFAILFAST(strName.Promote(&promotedName));
+        IFCFAILFAST(XStringInternTable::Intern(strName, &promotedName));
 
         ASSERT(m_nameTableMap.size() <= std::numeric_limits<UINT32>::max());
         auto result = m_nameTableMap.insert(std::make_pair(promotedName, static_cast<UINT32>(m_nameTableMap.size())));
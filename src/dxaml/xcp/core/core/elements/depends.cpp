@@ -21,6 +21,7 @@
 #include <xcperrorresource.h>
 #include <SimplePropertiesHelpers.h>
 #include <UIAWrapper.h>
+#include <DependencyObjectAllocationStatistics.h>
 #include <string>
 
 #pragma warning(disable:4267) //'var' : conversion from 'size_t' to 'type', possible loss of data
@@ -411,6 +412,9 @@ void CDependencyObject::ReleaseImpl(UINT32 cRef)
         }
         else
         {
+#if DBG
+            DependencyObjectAllocationStatistics::OnDestroyed(this);
+#endif
             delete this;
         }
     }
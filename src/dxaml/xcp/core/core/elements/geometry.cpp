@@ -7,6 +7,8 @@
 #include "VisualContentRenderer.h"
 #include "d3d11device.h"
 #include "WindowsGraphicsDeviceManager.h"
+#include "PackedPathGeometry.h"
+#include "GeometryHitTestCache.h"
 
 //------------------------------------------------------------------------
 //
@@ -1613,6 +1615,29 @@ CPathGeometry::Create(
     if (pCreate->m_value.GetType() == valueString)
     {
         CGeometryBuilder *pBuilder;
+        PathGeometryParseCache *pParseCache = pCreate->m_pCore->GetPathGeometryParseCache();
+
+        // If we're given a string then parse it now, unless a geometry was already created
+        // from the same string.
+        XUINT32 cString = 0;
+        const WCHAR* pString = pCreate->m_value.AsEncodedString().GetBufferAndCount(&cString);
+        std::shared_ptr<const PackedPathGeometry> spParsed = pParseCache->Find(cString, pString);
+
+        if (!spParsed)
+        {
+            auto spNewParsed = std::make_shared<PackedPathGeometry>();
+            IFC(ParseGeometry(cString, pString, TRUE, spNewParsed.get()));
+            spNewParsed->Compact();
+
+            spParsed = std::move(spNewParsed);
+            pParseCache->Add(cString, pString, spParsed);
+        }
+
+        if (spParsed->HasFillMode())
+        {
+            _this->m_fillMode = spParsed->GetFillMode();
+        }
+
         pCreate->m_pCore->ResetGeometryBuilder(0);
 
         //
@@ -1625,10 +1650,7 @@ CPathGeometry::Create(
             &pBuilder,
             TRUE));
 
-        // If we're given a string then parse it now.
-        XUINT32 cString = 0;
-        const WCHAR* pString = pCreate->m_value.AsEncodedString().GetBufferAndCount(&cString);
-        IFC(_this->ParseGeometry(pBuilder, cString, pString, TRUE));
+        IFC(spParsed->Replay(pBuilder));
 
         IFC(pBuilder->ClosePathGeometryBuilder(_this));
     }
@@ -1647,7 +1669,8 @@ Cleanup:
 //
 //  Synopsis:
 //      Parses the geometry mini-language.  Could be used to build either or
-//      both the Path.Data and Path.Clip attributes.
+//      both the Path.Data and Path.Clip attributes.  The result records the
+//      geometry builder calls the string stands for, see PackedPathGeometry.
 //
 //------------------------------------------------------------------------
 
@@ -1655,10 +1678,10 @@ Cleanup:
 
 _Check_return_ HRESULT
 CPathGeometry::ParseGeometry(
-    _In_ CGeometryBuilder *pBuilder,
     _In_ XUINT32 cData,
     _In_reads_(cData) const WCHAR *pRasterizerPath,
-    _In_ XINT32 bAllowFill
+    _In_ XINT32 bAllowFill,
+    _Out_ PackedPathGeometry *pGeometry
     )
 {
     XINT32      bComma = FALSE;         // Is a comma allowed at this time
@@ -1787,42 +1810,44 @@ CPathGeometry::ParseGeometry(
                     aptArc[0].x = aNumeric[5];
                     aptArc[0].y = aNumeric[6];
                     aptArc[1] = *((XPOINTF *) &aNumeric[0]);
-                    IFC_RETURN(pBuilder->AddArc(flags, aptArc, aNumeric[2], *((XINT32 *) &aNumeric[3]), *((XINT32 *) &aNumeric[4])));
+                    pGeometry->AddArc(flags, aptArc, aNumeric[2], *((XINT32 *) &aNumeric[3]), *((XINT32 *) &aNumeric[4]));
                     break;
 
-            // Add a cubic Bezier curve to the geometry
+            // Add a cubic Bezier curve to the geometry.  The first control point of
+            // a smooth curve is computed by the builder when the geometry is built.
 
                 case 'S':
-                    IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeBezier, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddSmoothBezier(flags, (XPOINTF *) &aNumeric[2]);
+                    break;
 
                 case 'C':
-                    IFC_RETURN(pBuilder->AddBezier(flags, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddBezier(flags, (XPOINTF *) &aNumeric[0]);
                     break;
 
             // Set the fill mode of the geometry
 
                 case 'F':
-                    m_fillMode = *((XINT32 *) &aNumeric[0]) ? XcpFillModeWinding : XcpFillModeAlternate;
+                    pGeometry->SetFillMode(*((XINT32 *) &aNumeric[0]) ? XcpFillModeWinding : XcpFillModeAlternate);
                     break;
 
             // Add a line segment to the geometry
 
                 case 'H':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_X, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddLine(flags | VALID_X, *((XPOINTF *) &aNumeric[0]));
                     break;
 
                 case 'L':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_XY, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddLine(flags | VALID_XY, *((XPOINTF *) &aNumeric[0]));
                     break;
 
                 case 'V':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_Y, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddLine(flags | VALID_Y, *((XPOINTF *) &aNumeric[0]));
                     break;
 
             // Start a new figure in the geometry
 
                 case 'M':
-                    IFC_RETURN(pBuilder->OpenFigure(flags, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->OpenFigure(flags, *((XPOINTF *) &aNumeric[0]));
 
                 // Any points after the 'M' are implicitly a lineto unless there is another command
                 // Use cmd-- to convert an 'M' to 'L' and an 'm' to 'l'
@@ -1833,10 +1858,11 @@ CPathGeometry::ParseGeometry(
             // Add a quadratic Bezier curve to the geometry
 
                 case 'T':
-                    IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeQuadratic, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddSmoothQuadratic(flags, *((XPOINTF *) &aNumeric[2]));
+                    break;
 
                 case 'Q':
-                    IFC_RETURN(pBuilder->AddQuadratic(flags, (XPOINTF *) &aNumeric[0]));
+                    pGeometry->AddQuadratic(flags, (XPOINTF *) &aNumeric[0]);
                     break;
                 }
             }
@@ -1940,7 +1966,7 @@ CPathGeometry::ParseGeometry(
                 break;
 
             case 'Z':   // Close a figure
-                IFC_RETURN(pBuilder->CloseFigure());
+                pGeometry->CloseFigure();
                 cmd = 0;
                 break;
 
@@ -2026,6 +2052,9 @@ CPathGeometry::DrawLines(
 
     ASSERT(uiPointCount > 1);
 
+    // The figures are replaced without going through the property system.
+    m_hitTestCache.reset();
+
     if (!m_pFigures)
     {
         IFC(CPathFigureCollection::Create(
@@ -2096,6 +2125,139 @@ CPathGeometry::VisitSinkInternal(
     return S_OK;
 }
 
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Test if the fill of this geometry contains the specified point, using
+//      the flattened edges kept from the previous hit test when possible.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CPathGeometry::HitTestFill(
+    _In_ const XPOINTF& target,
+    _In_opt_ const CMILMatrix* pTransform,
+    _Out_ bool* pHit
+    )
+{
+    if (m_hitTestCache == nullptr)
+    {
+        m_hitTestCache = std::make_unique<GeometryHitTestCache>();
+    }
+
+    GeometryFillMode fillMode = GeometryFillMode::Alternate;
+    const HitTestEdgeList* pEdges = m_hitTestCache->GetFillEdges(pTransform, &fillMode);
+
+    if (pEdges == nullptr)
+    {
+        xref_ptr<EdgeRecordingGeometrySink> sink;
+        sink.attach(new EdgeRecordingGeometrySink(
+            *m_hitTestCache->BeginFillEdges(pTransform),
+            GeometryHitTestCache::c_tolerance,
+            pTransform));
+
+        IFC_RETURN(VisitSink(sink));
+        IFC_RETURN(sink->Close());
+
+        if (sink->EncounteredNaN())
+        {
+            m_hitTestCache->DiscardFillEdges();
+            return CGeometry::HitTestFill(target, pTransform, pHit);
+        }
+
+        fillMode = sink->GetFillMode();
+        pEdges = m_hitTestCache->EndFillEdges(fillMode);
+    }
+
+    bool isNearEdge = false;
+    const XINT32 windingNumber = pEdges->GetWindingNumber(target, &isNearEdge);
+
+    if (isNearEdge)
+    {
+        *pHit = true;
+    }
+    else if (fillMode == GeometryFillMode::Alternate)
+    {
+        *pHit = ((windingNumber & 1) != 0);
+    }
+    else
+    {
+        *pHit = (windingNumber != 0);
+    }
+
+    return S_OK;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Test if the stroke of this geometry contains the specified point,
+//      using the widened outline kept from the previous hit test when the
+//      pen and transform are the same.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CPathGeometry::HitTestStroke(
+    _In_ const XPOINTF& target,
+    _In_ const CPlainPen& pen,
+    _In_opt_ const CMILMatrix* pTransform,
+    _Out_ bool* pHit
+    )
+{
+    if (pen.IsEmpty())
+    {
+        *pHit = false;
+        return S_OK;
+    }
+
+    if (m_hitTestCache == nullptr)
+    {
+        m_hitTestCache = std::make_unique<GeometryHitTestCache>();
+    }
+
+    const HitTestEdgeList* pEdges = m_hitTestCache->GetStrokeEdges(pen, pTransform);
+
+    if (pEdges == nullptr)
+    {
+        EdgeRecordingHitTestHelper hitTestHelper(
+            *m_hitTestCache->BeginStrokeEdges(pen, pTransform),
+            GeometryHitTestCache::c_tolerance,
+            nullptr);
+        CStrokeHitTestSink sink(hitTestHelper);
+
+        IFC_RETURN(WidenToSink(pen, pTransform, &sink));
+
+        if (hitTestHelper.EncounteredNaN())
+        {
+            m_hitTestCache->DiscardStrokeEdges();
+            return CGeometry::HitTestStroke(target, pen, pTransform, pHit);
+        }
+
+        pEdges = m_hitTestCache->EndStrokeEdges();
+    }
+
+    bool isNearEdge = false;
+    const bool isInside = pEdges->IsInsideAnyPiece(target, &isNearEdge);
+
+    *pHit = isInside || isNearEdge;
+
+    return S_OK;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Drops the cached hit test edges when anything under the geometry
+//      changes.
+//
+//------------------------------------------------------------------------
+void
+CPathGeometry::NWPropagateDirtyFlag(DirtyFlags flags)
+{
+    m_hitTestCache.reset();
+
+    __super::NWPropagateDirtyFlag(flags);
+}
+
 WUComp::ICompositionGeometry* CPathGeometry::GetCompositionGeometry(_In_ VisualContentRenderer* renderer)
 {
     if (IsGeometryDirty() || m_wucGeometry == nullptr)
@@ -27,6 +27,8 @@
 #include <DependencyLocator.h>
 #include "XamlTraceLogging.h"
 #include "XamlTraceSession.h"
+#include "XamlTelemetry.h"
+#include <XStringInternTable.h>
 #include <TrimWhitespace.h>
 #include <StringConversions.h>
 #include <ParserAPI.h>
@@ -34,6 +36,10 @@
 #include <FrameworkTheming.h>
 #include <SystemThemingInterop.h>
 #include <ThemeWalkResourceCache.h>
+#include "resources\inc\ResourceResolutionCache.h"
+#include "PackedPathGeometry.h"
+#include "TextBlockMeasureCache.h"
+#include "AnimatedFrameCache.h"
 #include <GraphicsUtility.h>
 #include <DXamlServices.h>
 #include <AutoReentrantReferenceLock.h>
@@ -666,6 +672,32 @@ CCoreServices::~CCoreServices() noexcept
 
     m_bIsDestroyingCoreServices = TRUE;
 
+    {
+        // The intern table is shared by every core in the process, so this reports its totals so far.
+        const XStringInternTable::Statistics internStatistics = XStringInternTable::GetStatistics();
+
+        TraceLoggingProviderWrite(
+            XamlTelemetry, "XString_InternTableStatistics",
+            TraceLoggingUInt32(internStatistics.EntryCount, "EntryCount"),
+            TraceLoggingUInt32(internStatistics.HitCount, "HitCount"),
+            TraceLoggingUInt32(internStatistics.MissCount, "MissCount"),
+            TraceLoggingUInt64(internStatistics.BytesSaved, "BytesSaved"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
+    if (m_textBlockMeasureCache)
+    {
+        const TextBlockMeasureCache::Statistics measureStatistics = m_textBlockMeasureCache->GetStatistics();
+
+        TraceLoggingProviderWrite(
+            XamlTelemetry, "Text_TextBlockMeasureCacheStatistics",
+            TraceLoggingUInt32(measureStatistics.EntryCount, "EntryCount"),
+            TraceLoggingUInt32(measureStatistics.HitCount, "HitCount"),
+            TraceLoggingUInt32(measureStatistics.MissCount, "MissCount"),
+            TraceLoggingUInt32(measureStatistics.FlushCount, "FlushCount"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
     // TODO: Do this now or in ResetVisualTree?
     // Shutdown the work items early in the process of shutting down the core
     if (m_pWorkItemFactory != NULL)
@@ -6274,6 +6306,12 @@ CCoreServices::NWDrawTree(
             }
         }
 
+        // Long paragraphs format the lines past their first screens a batch per frame, pick up the next batch.
+        if (m_pTextCore != NULL)
+        {
+            m_pTextCore->ResumeDeferredLineFormatting();
+        }
+
         // User or framework could have changed layout in the callback.
         IFC(pLayoutManager->UpdateLayout(uLayoutWidth, uLayoutHeight));
 
@@ -8306,6 +8344,12 @@ _Check_return_ HRESULT CCoreServices::CheckMemoryUsage(bool simulateLowMemory)
         // release the unused textFormatters to reduce memory usage
         ReleaseCachedTextFormatters();
 
+        // Give back the slab chunks that no longer hold any objects.
+        XcpAllocation::TrimSlabAllocator();
+
+        // Drop the decoded animated image frames, they're decoded again as needed.
+        AnimatedFrameCache::TrimAll();
+
         OnLowMemory();
     }
 
@@ -9265,6 +9309,41 @@ Diagnostics::ResourceLookupLogger* CCoreServices::GetResourceLookupLogger()
     return m_resourceLookupLogger.get();
 }
 
+Resources::ResourceResolutionCache* CCoreServices::GetResourceResolutionCache()
+{
+    if (!m_resourceResolutionCache)
+    {
+        m_resourceResolutionCache = std::make_unique<Resources::ResourceResolutionCache>();
+    }
+    return m_resourceResolutionCache.get();
+}
+
+PathGeometryParseCache* CCoreServices::GetPathGeometryParseCache()
+{
+    if (!m_pathGeometryParseCache)
+    {
+        m_pathGeometryParseCache = std::make_unique<PathGeometryParseCache>();
+    }
+    return m_pathGeometryParseCache.get();
+}
+
+TextBlockMeasureCache* CCoreServices::GetTextBlockMeasureCache()
+{
+    if (!m_textBlockMeasureCache)
+    {
+        m_textBlockMeasureCache = std::make_unique<TextBlockMeasureCache>();
+    }
+    return m_textBlockMeasureCache.get();
+}
+
+void CCoreServices::ClearTextBlockMeasureCache()
+{
+    if (m_textBlockMeasureCache)
+    {
+        m_textBlockMeasureCache->Clear();
+    }
+}
+
 //------------------------------------------------------------------------
 //
 //  Synopsis:
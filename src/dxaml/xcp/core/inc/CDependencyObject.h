@@ -28,6 +28,7 @@
 #include "EffectiveValue.h"
 #include "InheritanceContextChangeKind.h"
 #include <weakref_count.h>
+#include "XcpSlabAllocator.h"
 #include <weakref_ptr.h>
 #include <vector_map.h>
 #include <forward_list>
@@ -374,6 +375,17 @@ public:
 
     DECLARE_CREATE(CDependencyObject);
 
+    // Core objects come from the slab allocator when it's enabled, see XcpSlabAllocator.h.
+    static void* operator new(size_t cSize)
+    {
+        return XcpAllocation::SlabAllocate(cSize);
+    }
+
+    static void operator delete(void* pAddress)
+    {
+        XcpAllocation::SlabFree(pAddress);
+    }
+
     // AddRef and Release are intentionally not virtual since they are very hot and we're instead implementing
     // IUnknown and IInspectable via interface forwarding.  This is good because it avoids a bunch of costs
     // of virtuals on these hot functions - CFG checks, vtable costs in terms of binary size, and so on.
@@ -852,7 +864,11 @@ public:
     CDependencyObject* MapPropertyAndGroupOffsetToDO(_In_ UINT offset, _In_ UINT groupOffset);
     CValue* MapPropertyAndGroupOffsetToCValueNoRef(_In_ UINT offset, _In_ UINT groupOffset);
 
-    typedef containers::vector_map<KnownPropertyIndex, EffectiveValue> SparseValueTable;
+    typedef containers::vector_map<
+        KnownPropertyIndex,
+        EffectiveValue,
+        std::less<>,
+        XcpAllocation::SlabStlAllocator<std::pair<KnownPropertyIndex, EffectiveValue>>> SparseValueTable;
     typedef SparseValueTable::value_type SparseValueEntry;
     const std::unique_ptr<SparseValueTable>& GetValueTable() const
     {
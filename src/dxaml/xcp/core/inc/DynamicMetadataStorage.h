@@ -117,6 +117,19 @@ namespace DirectUI
         using PropertiesTable       = containers::vector_map<xstring_ptr, const CDependencyProperty*>;
         using PropertiesByTypeTable = std::unordered_map<KnownTypeIndex, std::unique_ptr<PropertiesTable>>;
 
+        // What a {Binding} path step name resolved to on a type. Names that resolved to nothing are
+        // kept too, so bindings to plain properties don't ask the metadata provider again.
+        struct BindingPathStepProperties
+        {
+            bool m_isDPResolved                 = false;
+            bool m_isPropertyResolved           = false;
+            const CDependencyProperty* m_dp     = nullptr;
+            const CDependencyProperty* m_property = nullptr;
+        };
+
+        using BindingPathStepsTable         = containers::vector_map<xstring_ptr, BindingPathStepProperties>;
+        using BindingPathStepsByTypeTable   = std::unordered_map<KnownTypeIndex, std::unique_ptr<BindingPathStepsTable>>;
+
         containers::vector_map<xstring_ptr, const CNamespaceInfo*>  m_customNamespacesByNameCache;
         std::vector<std::unique_ptr<CNamespaceInfo>>                m_customNamespacesCache;
 
@@ -126,6 +139,8 @@ namespace DirectUI
 
         std::unique_ptr<PropertiesByTypeTable>                      m_customDPsByTypeAndNameCache;
         std::unique_ptr<PropertiesByTypeTable>                      m_customPropertiesByTypeAndNameCache;
+        std::unique_ptr<BindingPathStepsByTypeTable>                m_bindingPathStepsByTypeAndNameCache;
+        XUINT32                                                     m_bindingPathStepsGeneration = 0; // Bumped whenever the cache above is cleared.
         std::vector<CDependencyProperty*>                           m_customPropertiesCache; // Stores both DPs and regular properties.
 
         std::unique_ptr<std::vector<ctl::ComPtr<xaml::IDependencyProperty>>>   m_dpHandleCache;
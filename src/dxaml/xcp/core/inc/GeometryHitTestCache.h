@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class CPlainPen;
+
+//------------------------------------------------------------------------
+//
+//  Class:  HitTestEdgeList
+//
+//  Synopsis:
+//      The flattened edges of a geometry, bucketed into horizontal bands so
+//  that a point hit test only looks at the edges that reach its row. Edges
+//  are grouped into pieces that each get their own winding number, the way
+//  the quads and caps of a widened stroke are hit tested one at a time.
+//
+//------------------------------------------------------------------------
+
+class HitTestEdgeList
+{
+public:
+    // Recording, called while the geometry is flattened.
+    void BeginPiece();
+    void AddEdge(_In_ const XPOINTF& from, _In_ const XPOINTF& to);
+
+    // Buckets the recorded edges. Edges within tolerance of a band are put in it,
+    // so that the near edge test only needs the band of the point too.
+    void Build(_In_ XFLOAT tolerance);
+
+    // Sum of the winding numbers of all pieces around the point.
+    XINT32 GetWindingNumber(_In_ const XPOINTF& point, _Out_ bool* pIsNearEdge) const;
+
+    // Whether any single piece has a non-zero winding number around the point. Stops at
+    // the first such piece, so pIsNearEdge only covers the edges tested before it.
+    bool IsInsideAnyPiece(_In_ const XPOINTF& point, _Out_ bool* pIsNearEdge) const;
+
+private:
+    struct Edge
+    {
+        XPOINTF From;
+        XPOINTF To;
+        XUINT32 Piece;
+    };
+
+    // Aim for a handful of edges per band, and give up on banding when the edges
+    // are so long that each one would land in many bands.
+    static constexpr XUINT32 c_edgesPerBand = 8;
+    static constexpr XUINT32 c_maxBandCount = 1024;
+    static constexpr XUINT32 c_maxBandsPerEdge = 16;
+
+    bool TestEdge(_In_ const Edge& edge, _In_ const XPOINTF& point, _Inout_ XINT32* pWindingNumber) const;
+    bool GetBandEdges(_In_ const XPOINTF& point, _Out_ const XUINT32** ppBegin, _Out_ const XUINT32** ppEnd) const;
+    XUINT32 GetBand(_In_ XFLOAT y) const;
+
+    std::vector<Edge> m_edges;
+    XUINT32 m_pieceCount = 0;
+
+    // m_bandEdges[m_bandStarts[i]] to m_bandEdges[m_bandStarts[i + 1]] are the
+    // indices of the edges in band i, in recording order.
+    std::vector<XUINT32> m_bandStarts;
+    std::vector<XUINT32> m_bandEdges;
+    XUINT32 m_bandCount = 0;
+    XFLOAT m_bandScale = 0.0f;
+    XFLOAT m_tolerance = 0.0f;
+
+    // Edge bounds grown by the tolerance, a point outside them can't be hit.
+    XFLOAT m_top = 0.0f;
+    XFLOAT m_bottom = 0.0f;
+    XFLOAT m_right = 0.0f;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  GeometryHitTestCache
+//
+//  Synopsis:
+//      The flattened fill and widened stroke of a geometry, kept between
+//  point hit tests so that moving the pointer over a complex path does not
+//  flatten or widen it again each time. Each is only valid for the transform
+//  (and pen) it was made with. The owner drops the cache when the geometry
+//  changes.
+//
+//------------------------------------------------------------------------
+
+class GeometryHitTestCache
+{
+public:
+    static constexpr XFLOAT c_tolerance = 0.25f;
+
+    // Returns nullptr when the fill needs to be flattened for this transform.
+    const HitTestEdgeList* GetFillEdges(_In_opt_ const CMILMatrix* pTransform, _Out_ GeometryFillMode* pFillMode) const;
+
+    // Returns nullptr when the stroke needs to be widened for this pen and transform.
+    const HitTestEdgeList* GetStrokeEdges(_In_ const CPlainPen& pen, _In_opt_ const CMILMatrix* pTransform) const;
+
+    // Replacing the cached edges. Begin returns the list to record into, End buckets
+    // the recorded edges and makes them available. Edges whose flattening ran into NaN
+    // are discarded instead, and the caller takes the uncached path.
+    HitTestEdgeList* BeginFillEdges(_In_opt_ const CMILMatrix* pTransform);
+    const HitTestEdgeList* EndFillEdges(_In_ GeometryFillMode fillMode);
+    void DiscardFillEdges() { m_fill.reset(); }
+
+    HitTestEdgeList* BeginStrokeEdges(_In_ const CPlainPen& pen, _In_opt_ const CMILMatrix* pTransform);
+    const HitTestEdgeList* EndStrokeEdges();
+    void DiscardStrokeEdges() { m_stroke.reset(); }
+
+private:
+    struct FillEntry
+    {
+        CMILMatrix Transform{ true };
+        bool HasTransform = false;
+        GeometryFillMode FillMode = GeometryFillMode::Alternate;
+        bool IsBuilt = false;
+        HitTestEdgeList Edges;
+    };
+
+    struct StrokeEntry
+    {
+        explicit StrokeEntry(_In_ const CPlainPen& pen) : Pen(pen) {}
+
+        CPlainPen Pen;
+        CMILMatrix Transform{ true };
+        bool HasTransform = false;
+        bool IsBuilt = false;
+        HitTestEdgeList Edges;
+    };
+
+    static bool AreTransformsEqual(
+        bool hasTransform,
+        _In_ const CMILMatrix& transform,
+        _In_opt_ const CMILMatrix* pTransform);
+
+    static bool ArePensEqual(_In_ const CPlainPen& pen, _In_ const CPlainPen& other);
+
+    std::unique_ptr<FillEntry> m_fill;
+    std::unique_ptr<StrokeEntry> m_stroke;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  EdgeRecordingHitTestHelper
+//
+//  Synopsis:
+//      Records the flattened edges a hit test helper would test into an
+//  edge list. Each Reset starts a new piece.
+//
+//------------------------------------------------------------------------
+
+class EdgeRecordingHitTestHelper final : public HitTestHelper
+{
+public:
+    EdgeRecordingHitTestHelper(
+        _In_ HitTestEdgeList& edges,
+        XFLOAT tolerance,
+        _In_opt_ const CMILMatrix* pTransform
+        );
+
+    _Check_return_ HRESULT GetResult(
+        bool *pWasHit
+        ) override;
+
+    void Reset(
+        ) override;
+
+    bool EncounteredNaN() const { return m_encounteredNaN; }
+
+protected:
+    void AcceptPoint(
+        _In_ const XPOINTF& endPoint
+        ) override;
+
+private:
+    HitTestEdgeList& m_edges;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  EdgeRecordingGeometrySink
+//
+//  Synopsis:
+//      Geometry sink that records the flattened fill of a geometry.
+//
+//------------------------------------------------------------------------
+
+class EdgeRecordingGeometrySink final : public HitTestGeometrySink
+{
+public:
+    EdgeRecordingGeometrySink(
+        _In_ HitTestEdgeList& edges,
+        XFLOAT tolerance,
+        _In_opt_ const CMILMatrix* pTransform
+        );
+
+    _Check_return_ HRESULT GetResult(
+        _Out_ bool* pHit
+        ) override;
+
+    GeometryFillMode GetFillMode() const { return m_fillMode; }
+    bool EncounteredNaN() const { return m_hitTestHelper.EncounteredNaN(); }
+
+private:
+    EdgeRecordingHitTestHelper m_hitTestHelper;
+};
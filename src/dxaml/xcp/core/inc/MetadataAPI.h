@@ -191,6 +191,18 @@ namespace DirectUI
             _Outptr_result_maybenull_ const CDependencyProperty** ppProperty,
             _In_ bool allowDirectives = false);
 
+        // Same as TryGetDependencyPropertyByName and TryGetPropertyByName, for {Binding} path steps. Results are cached
+        // per type and name, including names that don't resolve, until the metadata is reset or a DP gets registered.
+        static _Check_return_ HRESULT TryGetDependencyPropertyForBindingPathStep(
+            _In_ const CClassInfo* pType,
+            _In_ const xstring_ptr_view& strName,
+            _Outptr_result_maybenull_ const CDependencyProperty** ppDP);
+
+        static _Check_return_ HRESULT TryGetPropertyForBindingPathStep(
+            _In_ const CClassInfo* pType,
+            _In_ const xstring_ptr_view& strName,
+            _Outptr_result_maybenull_ const CDependencyProperty** ppProperty);
+
         // Tries to resolve an attached property by its name. strName should use the format ClassName.PropertyName. This should only
         // be called for built-in attached properties.
         static _Check_return_ HRESULT TryGetAttachedPropertyByName(
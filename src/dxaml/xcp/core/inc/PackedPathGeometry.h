@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class CGeometryBuilder;
+
+//------------------------------------------------------------------------
+//
+//  Class:  PackedPathGeometry
+//
+//  Synopsis:
+//      Immutable result of parsing a path mini-language string. Holds the
+//  geometry builder calls the string stands for as a byte array of verbs
+//  and a flat array of their arguments, so that the string only needs to be
+//  parsed once no matter how many geometries are created from it.
+//
+//------------------------------------------------------------------------
+
+class PackedPathGeometry
+{
+public:
+    // Recording, one call per geometry builder call made by the parser.
+    void OpenFigure(_In_ XINT32 flags, _In_ const XPOINTF& point);
+    void CloseFigure();
+    void AddLine(_In_ XINT32 flags, _In_ const XPOINTF& point);
+    void AddBezier(_In_ XINT32 flags, _In_reads_(3) const XPOINTF* pPoints);
+    void AddQuadratic(_In_ XINT32 flags, _In_reads_(2) const XPOINTF* pPoints);
+    void AddArc(
+        _In_ XINT32 flags,
+        _In_reads_(2) const XPOINTF* pPoints,
+        _In_ XFLOAT angle,
+        _In_ XINT32 isLarge,
+        _In_ XINT32 isClockwise);
+
+    // The first control point of smooth curves is the reflection of the previous control
+    // point, which the builder computes when the geometry is replayed.
+    void AddSmoothBezier(_In_ XINT32 flags, _In_reads_(2) const XPOINTF* pPoints);
+    void AddSmoothQuadratic(_In_ XINT32 flags, _In_ const XPOINTF& point);
+
+    void SetFillMode(_In_ XcpFillMode fillMode);
+
+    // Releases the spare capacity left over from recording.
+    void Compact();
+
+    bool HasFillMode() const { return m_hasFillMode; }
+    XcpFillMode GetFillMode() const { return m_fillMode; }
+
+    // Makes the recorded calls on the builder.
+    _Check_return_ HRESULT Replay(_In_ CGeometryBuilder* pBuilder) const;
+
+private:
+    enum class Verb : uint8_t
+    {
+        OpenFigure,
+        CloseFigure,
+        AddLine,
+        AddBezier,
+        AddQuadratic,
+        AddArc,
+        AddSmoothBezier,
+        AddSmoothQuadratic,
+    };
+
+    void AddVerb(_In_ Verb verb, _In_ XINT32 flags);
+    void AddPoints(_In_reads_(count) const XPOINTF* pPoints, _In_ XUINT32 count);
+
+    // Each verb is followed by the point flags passed to the builder.
+    std::vector<uint8_t> m_verbs;
+    std::vector<XFLOAT> m_values;
+    XcpFillMode m_fillMode = XcpFillModeAlternate;
+    bool m_hasFillMode = false;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  PathGeometryParseCache
+//
+//  Synopsis:
+//      Shares the parsed form of path mini-language strings between the
+//  path geometries created from the same string, which is common for the
+//  icons in templates. One of these exists for each UI thread.
+//
+//------------------------------------------------------------------------
+
+class PathGeometryParseCache
+{
+public:
+    std::shared_ptr<const PackedPathGeometry> Find(_In_ XUINT32 cString, _In_reads_(cString) const WCHAR* pString) const;
+
+    void Add(
+        _In_ XUINT32 cString,
+        _In_reads_(cString) const WCHAR* pString,
+        _In_ std::shared_ptr<const PackedPathGeometry> geometry);
+
+private:
+    // Long strings are usually one-off drawings rather than shared icons.
+    static constexpr XUINT32 c_maxCachedStringLength = 4096;
+    static constexpr size_t c_maxEntries = 1024;
+
+    std::unordered_map<std::wstring, std::shared_ptr<const PackedPathGeometry>> m_entries;
+};
@@ -262,6 +262,12 @@ public:
         _Out_opt_ xref_ptr<CResourceDictionary>* themeResourcesReadFrom = nullptr);
 
 private:
+    _Check_return_ HRESULT GetKeyNoRefCached(
+        const ResourceKey& key,
+        Resources::LookupScope resourceLookupScope,
+        _Outptr_ CDependencyObject **ppDO,
+        _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom = nullptr);
+
     _Check_return_ HRESULT GetKeyNoRefImpl(
         const ResourceKey& key,
         Resources::LookupScope resourceLookupScope,
@@ -360,6 +366,12 @@ public:
     void InvalidateNotFoundCache(bool propagate);
     void InvalidateNotFoundCache(bool propagate, const ResourceKey& key);
 
+    // Version of this dictionary's lookup-visible state. Changes whenever a key is added or removed, the set of merged
+    // or theme dictionaries changes, or a different theme dictionary becomes active. Used by ResourceResolutionCache
+    // to validate memoized lookups.
+    std::uint64_t GetVersion() const { return m_version; }
+    void IncrementVersion();
+
     _Check_return_
     HRESULT DeferKeysAsXaml(
         _In_ const bool fIsDictionaryWithKeyProperty,
@@ -499,6 +511,8 @@ private:
 
     std::unique_ptr<Resources::details::ResourceKeyCache> m_keysNotFoundCache;
 
+    std::uint64_t m_version;
+
     unsigned int m_bHasKey                     : 1;
     unsigned int m_bAllowItems                 : 1;
     unsigned int m_bIsThemeDictionaries        : 1; // Represents ResourceDictionary.ThemeDictionaries
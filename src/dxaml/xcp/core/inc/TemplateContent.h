@@ -164,6 +164,10 @@ private:
     std::vector< std::shared_ptr<XamlQualifiedObject> > m_cachedTemplateContentObjects;
     std::shared_ptr<XamlBinaryFormatSubReader2> m_spSubReader;
 
+    // The nodes the first load of the optimized content decoded from m_spSubReader. They come out
+    // the same on every load, so the loads after it write them without decoding the stream again.
+    std::vector<ObjectWriterNode> m_compiledNodes;
+
     std::shared_ptr<XamlSavedContext> m_spXamlSavedContext;
     xref::weakref_ptr<CDependencyObject> m_spEventRoot;
     bool m_bContentAlreadyOptimized : 1;
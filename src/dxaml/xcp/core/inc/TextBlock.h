@@ -231,7 +231,7 @@ public:
 
     _Check_return_ HRESULT OnPointerCaptureLost(_In_ CEventArgs* pEventArgs) final;
 
-    _Check_return_ HRESULT GetDWriteTextLayout(_Out_ IDWriteTextLayout** textLayout) const;
+    _Check_return_ HRESULT GetDWriteTextLayout(_Out_ IDWriteTextLayout** textLayout);
     TextMode GetTextMode() const { return m_textMode; }
     const xstring_ptr GetText() const { return m_strText; }
     _Check_return_ HRESULT GetFlowDirection(_Out_ DirectUI::FlowDirection* flowDirection);
@@ -297,6 +297,12 @@ private:
         const XSIZEF availableSize,
         const float baseline,
         const float lineAdvance) noexcept;
+    _Check_return_ HRESULT FormatDWriteTextLayout(
+        const XSIZEF availableSize,
+        const float baseline,
+        const float lineAdvance,
+        _Out_ DWRITE_TEXT_METRICS* pTextMetrics);
+    _Check_return_ HRESULT EnsureDWriteTextLayout();
     _Check_return_ HRESULT GetDWriteTextMetricsOffset(_Out_ XPOINTF* offset);
     _Check_return_ HRESULT GetLineHeight(_Out_ float* baseline, _Out_ float* lineAdvance);
 
@@ -465,6 +471,7 @@ private:
     BlockNode*                                  m_pPageNode;
     TextBlockView*                              m_pTextView;
     wrl::ComPtr<IDWriteTextLayout>              m_pTextLayout;
+    XSIZEF                                      m_deferredTextLayoutSize = {};
     xref_ptr<D2DTextDrawingContext>             m_pTextDrawingContext;
     AlphaMask                                   m_alphaMask;
     CFontContext*                               m_pFontContext;
@@ -510,6 +517,11 @@ private:
     // unique to TextBlock
     uint32_t                                    m_hasBeenMeasured                                   : 1;
 
+    // Set when MeasureOverride found the metrics in the TextBlockMeasureCache and left formatting
+    // m_pTextLayout to whoever needs it first, at m_deferredTextLayoutSize.
+    // unique to TextBlock
+    uint32_t                                    m_isDWriteTextLayoutDeferred                        : 1;
+
     // Determines if the control has to override the foreground to the hyperlink foreground brush when HighContrastAdjustment is enabled.
     // unique to TextBlock
     uint32_t                                    m_useHyperlinkForegroundOnBackPlate                 : 1;
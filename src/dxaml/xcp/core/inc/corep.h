@@ -162,6 +162,13 @@ namespace Theming {
     enum class Theme : uint8_t;
 }
 
+namespace Resources {
+    class ResourceResolutionCache;
+}
+
+class PathGeometryParseCache;
+class TextBlockMeasureCache;
+
 #include "Indexes.g.h"
 #include "TypeBits.h"
 #include "enumdefs.h"
@@ -388,6 +395,9 @@ private:
     // Store the last Text Control that has some text selected.
     CUIElement                 *m_pLastSelectedTextElement;
 
+    // Text controls with paragraphs that left lines to be formatted in a later frame.
+    std::vector<xref::weakref_ptr<CFrameworkElement>> m_deferredLineFormattingOwners;
+
 public:
     CTextCore(_In_ CCoreServices *pCore);
 
@@ -416,6 +426,8 @@ public:
     void SetLastSelectedTextElement(_In_ CUIElement *pLastSelectedTextElement);
     void ClearLastSelectedTextElement();
     HRESULT ConfigureNumberSubstitution();
+    void RegisterDeferredLineFormatting(_In_ CFrameworkElement *pOwner);
+    void ResumeDeferredLineFormatting();
     static bool IsTextControl(_In_ CDependencyObject* pDO);
     static bool IsTextSelectionEnabled(_In_ CDependencyObject* textControl);
     bool CanSelectText(_In_ CUIElement* pTextElement) const;
@@ -1331,6 +1343,12 @@ public:
 
     CResourceDictionary* GetThemeResources();
 
+    // Unlike GetThemeResources, doesn't load the theme resources if they haven't been loaded yet.
+    CResourceDictionary* GetThemeResourcesNoCreate() const
+    {
+        return m_pThemeResources;
+    }
+
     bool HasThemeEverChanged() const
     {
         return m_hasThemeEverChanged;
@@ -1720,6 +1738,13 @@ public:
 
     Diagnostics::ResourceLookupLogger* GetResourceLookupLogger();
 
+    Resources::ResourceResolutionCache* GetResourceResolutionCache();
+
+    PathGeometryParseCache* GetPathGeometryParseCache();
+
+    TextBlockMeasureCache* GetTextBlockMeasureCache();
+    void ClearTextBlockMeasureCache();
+
 public:
     XUINT32                  m_uFrameNumber;
     int                      m_framesToSkip = 0;
@@ -1955,6 +1980,16 @@ private:
     // One of these exists for each UI thread.
     std::unique_ptr<Diagnostics::ResourceLookupLogger> m_resourceLookupLogger;
 
+    // Memoized resource dictionary lookups, see ResourceResolutionCache. Like the logger above, this sits on every
+    // resource lookup, and one of these exists for each UI thread.
+    std::unique_ptr<Resources::ResourceResolutionCache> m_resourceResolutionCache;
+
+    // Parsed Path.Data strings, shared by the path geometries created from the same string.
+    std::unique_ptr<PathGeometryParseCache> m_pathGeometryParseCache;
+
+    // DWrite metrics of TextBlocks, shared by the TextBlocks showing the same text in the same formatting.
+    std::unique_ptr<TextBlockMeasureCache> m_textBlockMeasureCache;
+
     // The DComp page rotation manager has a policy that skips the animation for the next rotation change after the
     // window goes from invisible to visible in order to prevent showing a stale frame. Due to timing variations,
     // sometimes the rotation notification comes after the window is made visible, which we correctly ignore, but
@@ -66,6 +66,8 @@ enum XcpPointType
 class CPathGeometry;
 class CPathFigureCollection;
 class CPathFigure;
+class PackedPathGeometry;
+class GeometryHitTestCache;
 
 //------------------------------------------------------------------------
 //
@@ -577,11 +579,11 @@ protected:
         ) override;
 
 private:
-    _Check_return_ HRESULT ParseGeometry(
-        _In_ CGeometryBuilder *pBuilder,
+    static _Check_return_ HRESULT ParseGeometry(
         _In_ XUINT32 cString,
         _In_reads_(cString) const WCHAR *pString,
-        _In_ XINT32 bAllowFill
+        _In_ XINT32 bAllowFill,
+        _Out_ PackedPathGeometry *pGeometry
         );
 
 public:
@@ -593,10 +595,33 @@ public:
     //  Bounds and Hit Testing
     //
     //-----------------------------------------------------------------------------
+public:
+    using CGeometry::HitTestFill;
+    using CGeometry::HitTestStroke;
+
+    _Check_return_ HRESULT HitTestFill(
+        _In_ const XPOINTF& target,
+        _In_opt_ const CMILMatrix* pTransform,
+        _Out_ bool* pHit
+        ) override;
+
+    _Check_return_ HRESULT HitTestStroke(
+        _In_ const XPOINTF& target,
+        _In_ const CPlainPen& pen,
+        _In_opt_ const CMILMatrix* pTransform,
+        _Out_ bool* pHit
+        ) override;
+
 protected:
+    void NWPropagateDirtyFlag(DirtyFlags flags) override;
+
     _Check_return_ HRESULT VisitSinkInternal(
         _In_ IPALGeometrySink* pSink
         ) override;
+
+private:
+    // Flattened edges for point hit tests, dropped whenever the geometry changes.
+    std::unique_ptr<GeometryHitTestCache> m_hitTestCache;
 };
 
 // This class "wraps" ID2D1Geometry as a IGeometrySource2D
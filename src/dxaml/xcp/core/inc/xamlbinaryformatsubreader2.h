@@ -41,6 +41,10 @@ public:
     unsigned int get_NextIndex() const { return m_currentNodeStreamOffset; }
     void Reset() { m_currentNodeStreamOffset = 0;  }
 
+    // Constants are normally read into the one XamlQualifiedObject that the next Read reuses (see
+    // m_spTemporaryValue). Turn this off to give each node that's kept around its own.
+    void set_ReuseConstantValue(bool value) { m_reuseConstantValue = value; }
+
     // The XamlBinaryFormatSubreader is used for two main purposes today:
 
     // Pulling ObjectWriterNodes out of a stream and using those nodes to create
@@ -175,5 +179,6 @@ private:
     // when the next call to Read occurs, chiefly this XQO instance is reused over
     // and over again.
     std::shared_ptr<XamlQualifiedObject> m_spTemporaryValue;
+    bool m_reuseConstantValue = true;
 };
 
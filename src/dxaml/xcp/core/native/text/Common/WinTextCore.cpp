@@ -611,6 +611,9 @@ _Check_return_ HRESULT WinTextCore::SetSystemFontCollectionOverride(_In_opt_ IDW
     IFC_RETURN(pDWriteFontServices->SetSystemFontCollectionOverride(pFontCollection));
     pPalFontServices->ResetSystemFontCollection();
 
+    // The cached TextBlock metrics were measured with the fonts being replaced.
+    m_pCore->ClearTextBlockMeasureCache();
+
     return S_OK;
 }
 
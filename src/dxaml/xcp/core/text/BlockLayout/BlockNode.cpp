@@ -33,6 +33,7 @@ BlockNode::BlockNode(
     m_measureBottomless(FALSE),
     m_isMeasureBypassed(FALSE),
     m_isArrangeBypassed(FALSE),
+    m_hasDeferredContent(FALSE),
     m_cachedMaxLines(0),
     m_measuredLines(0)
 {
@@ -112,6 +113,9 @@ _Check_return_ HRESULT BlockNode::Measure(
     {
         m_isMeasureInProgress = TRUE;
 
+        // Children that still have deferred content will mark this node again while they're measured.
+        m_hasDeferredContent = FALSE;
+
         IFC(MeasureCore(availableSize,
                         maxLines,
                         allowEmptyContent,
@@ -281,6 +285,22 @@ void BlockNode::InvalidateArrange()
     }
 }
 
+//---------------------------------------------------------------------------
+//
+// BlockNode::SetHasDeferredContent
+//
+//---------------------------------------------------------------------------
+void BlockNode::SetHasDeferredContent()
+{
+    BlockNode *pNode = this;
+
+    while (pNode != NULL && !pNode->m_hasDeferredContent)
+    {
+        pNode->m_hasDeferredContent = TRUE;
+        pNode = pNode->m_pParentNode;
+    }
+}
+
 //---------------------------------------------------------------------------
 //
 // BlockNode::TransformOffsetFromRoot
@@ -402,6 +422,7 @@ _Check_return_ HRESULT BlockNode::CanBypassMeasure(
     HRESULT hr = S_OK;
     bool bypass = false;
     if (!IsMeasureDirty() &&
+        !HasDeferredContent() &&
         (IsEmptyContentAllowed() == allowEmptyContent) &&
         (IsMeasureBottomless() == measureBottomless) &&
         IsCloseReal(m_prevAvailableSize.width, availableSize.width) &&
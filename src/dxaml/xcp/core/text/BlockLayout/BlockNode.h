@@ -63,6 +63,10 @@ public:
     bool IsMeasureDirty() const;
     bool IsArrangeDirty() const;
 
+    // True when this node or one of its descendants left part of its content unformatted in the last
+    // Measure, and needs another Measure with the same constraints to finish it.
+    bool HasDeferredContent() const;
+
     virtual BlockNode *GetFirstChild() const;
     BlockNode *GetNext() const;
     BlockNode *GetPrevious() const;
@@ -154,6 +158,9 @@ protected:
     bool IsEmptyContentAllowed() const;
     bool IsMeasureBottomless() const;
 
+    // Marks this node and all its ancestors as having deferred content, so their Measure isn't bypassed.
+    void SetHasDeferredContent();
+
 private:    
     BlockNode *m_pNext;
     BlockNode *m_pPrevious;
@@ -171,6 +178,7 @@ private:
     bool m_measureBottomless : 1;
     bool m_isMeasureBypassed : 1;
     bool m_isArrangeBypassed : 1;
+    bool m_hasDeferredContent : 1;
 };
 
 inline bool BlockNode::IsMeasureDirty() const
@@ -183,6 +191,11 @@ inline bool BlockNode::IsArrangeDirty() const
     return m_isArrangeDirty;
 }
 
+inline bool BlockNode::HasDeferredContent() const
+{
+    return m_hasDeferredContent;
+}
+
 inline BlockNode *BlockNode::GetFirstChild() const
 {
     // Base BlockNode has no children, return NULL here.
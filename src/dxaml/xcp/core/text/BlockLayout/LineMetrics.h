@@ -22,6 +22,8 @@ struct LineMetrics
     XUINT32 Length;
     XRECTF Rect;
     XFLOAT VerticalAdvance;
+    XFLOAT VerticalOffset;  // Sum of the VerticalAdvance of all preceding lines in the node.
+    XFLOAT HitTestBottom;   // Largest bottom edge (VerticalOffset + Rect.Y + VerticalAdvance) of this line and all preceding lines.
     XFLOAT BaselineOffset;
     RichTextServices::TextLineBreak *LineBreak;
     RichTextServices::TextLine *Line;
@@ -8,10 +8,18 @@
 #include "ParagraphDrawingContext.h"
 #include "ParagraphNodeBreak.h"
 #include "PageNode.h"
+#include <RuntimeEnabledFeatures.h>
 
 using namespace DirectUI;
 using namespace RichTextServices;
 
+// Lines of a paragraph measured without a height constraint that are formatted in the first Measure, by
+// height. It covers a few screens so scrolling a little right away doesn't reach the estimated part.
+static const XFLOAT c_deferLinesAfterHeight = 4096.0f;
+
+// Smallest number of lines formatted in a frame when continuing a paragraph with deferred lines.
+static const XUINT32 c_minDeferredLineBatch = 256;
+
 template class DynamicArray<LineMetrics>;
 
 //---------------------------------------------------------------------------
@@ -208,9 +216,9 @@ _Check_return_ HRESULT ParagraphNode::IsAtInsertionPosition(
     ASSERT(lineIndex < m_lines.GetCount());
     LineMetrics lineMetrics = m_lines[lineIndex];
 
-    if (!lineMetrics.HasMultiCharacterClusters)
+    if (!lineMetrics.HasMultiCharacterClusters || IsPositionDeferred(positionInParagraph))
     {
-       // Line does not have clusters. Use simple path to check for basic surrogates and CRLF pair.
+       // Line does not have clusters, or the position is past the formatted lines. Use simple path to check for basic surrogates and CRLF pair.
         bool isInSurrogateCRLF = false;
         IFC(m_textSource.IsInSurrogateCRLF(positionInParagraph, &isInSurrogateCRLF));
         *pIsAtInsertionPosition = !isInSurrogateCRLF;
@@ -348,6 +356,18 @@ _Check_return_ HRESULT ParagraphNode::GetTextBounds(
 
     // Start+Length is inclusive, so end index is start + length - 1.
     XUINT32 startPositionInParagraph = GetPositionInParagraph(start);
+
+    // Lines that haven't been formatted yet have no bounds to report.
+    if (IsPositionDeferred(startPositionInParagraph))
+    {
+        return S_OK;
+    }
+    if (IsPositionDeferred(GetPositionInParagraph(start + length - 1)))
+    {
+        length = m_deferredCharIndex - startPositionInParagraph;
+        remainingLength = length;
+    }
+
     XUINT32 startLineIndex = GetLineIndexFromPosition(startPositionInParagraph, &lineOffset);
     XUINT32 endPositionInParagraph = GetPositionInParagraph(start + length - 1);
     XUINT32 endLineIndex = GetLineIndexFromPosition(endPositionInParagraph, NULL);
@@ -447,6 +467,10 @@ _Check_return_ HRESULT ParagraphNode::MeasureCore(
     bool addLineToMetrics = true;
     bool firstLine = true;
     TextTrimming textTrimming = BlockLayoutHelpers::GetTextTrimming(m_pBlockLayoutEngine->GetOwner());
+    TextLineBreak *pResumedLineBreak = NULL;
+    bool canDeferLines = false;
+    XFLOAT deferLinesAfterHeight = XFLOAT_INF;
+    XUINT32 deferLinesAfterCount = XUINT32_MAX;
 
     if (pPreviousBreak != NULL)
     {
@@ -457,24 +481,60 @@ _Check_return_ HRESULT ParagraphNode::MeasureCore(
     IFC(BlockLayoutHelpers::GetTextFormatter(m_pBlockLayoutEngine->GetOwner(), &pTextFormatter));
     IFC(BlockLayoutHelpers::GetParagraphProperties(m_pElement, m_pBlockLayoutEngine->GetOwner(), &pParagraphProperties));
 
-    if (IsContentDirty())
+    if (m_resumeDeferredLines)
     {
-        // Currently this shouldn't ever be the case since we have no incremental content invalidation and PageNode
-        // deletes all its children when content is dirty.
-        if (m_pTextRunCache != NULL)
+        // Nothing that affects line breaking changed since the last Measure, so keep the lines formatted so far
+        // and continue where it stopped. Only the estimate for the rest of the paragraph is replaced.
+        ASSERT(m_pDeferredLineBreak != NULL);
+        pResumedLineBreak = m_pDeferredLineBreak;
+        m_pDeferredLineBreak = NULL;
+
+        pPreviousLineBreak = pResumedLineBreak;
+        firstCharIndex = m_deferredCharIndex;
+        m_length = m_deferredCharIndex;
+        m_desiredSize.height -= m_deferredHeightEstimate;
+        m_deferredHeightEstimate = 0.0f;
+        lineOffset = m_desiredSize.height;
+        allowEmptyContent = TRUE;
+        firstLine = FALSE;
+        InvalidateArrange();
+
+        // Growing the batches geometrically keeps the Arrange and Draw passes that follow each batch from
+        // adding up to more than a small multiple of the work to format the paragraph at once.
+        canDeferLines = true;
+        deferLinesAfterCount = m_lines.GetCount() + MAX(m_lines.GetCount(), c_minDeferredLineBatch);
+    }
+    else
+    {
+        if (IsContentDirty())
         {
-            m_pTextRunCache->Clear();
+            // Currently this shouldn't ever be the case since we have no incremental content invalidation and PageNode
+            // deletes all its children when content is dirty.
+            if (m_pTextRunCache != NULL)
+            {
+                m_pTextRunCache->Clear();
+            }
         }
-    }
-    DeleteLineCache();
-    RemoveEmbeddedElements();
-    InvalidateArrange();
-    m_cachedMaxLines = paragraphMaxLines;
+        DeleteLineCache();
+        RemoveEmbeddedElements();
+        InvalidateArrange();
+        m_cachedMaxLines = paragraphMaxLines;
 
-    m_desiredSize.width = m_desiredSize.height = 0;
-    m_untrimmedDesiredWidth = 0;
-    m_length = 0;
-    ReleaseInterface(m_pBreak);
+        m_desiredSize.width = m_desiredSize.height = 0;
+        m_untrimmedDesiredWidth = 0;
+        m_length = 0;
+        ReleaseInterface(m_pBreak);
+
+        if (pPreviousParagraphBreak != NULL)
+        {
+            pPreviousLineBreak = pPreviousParagraphBreak->GetLineBreak();
+            firstCharIndex = pPreviousParagraphBreak->GetBreakIndex();
+        }
+
+        canDeferLines = CanDeferLines(availableSize, paragraphMaxLines, textTrimming, pPreviousParagraphBreak);
+        deferLinesAfterHeight = c_deferLinesAfterHeight;
+    }
+    m_resumeDeferredLines = false;
 
     // Get line stacking info.
     IFC(BlockLayoutHelpers::GetLineStackingInfo(
@@ -485,12 +545,6 @@ _Check_return_ HRESULT ParagraphNode::MeasureCore(
         &defaultFontLineAdvance,
         &defaultLineHeight));
 
-    if (pPreviousParagraphBreak != NULL)
-    {
-        pPreviousLineBreak = pPreviousParagraphBreak ->GetLineBreak();
-        firstCharIndex = pPreviousParagraphBreak->GetBreakIndex();
-    }
-
     // We always want to measure at least one line, whether we add it or not.
     ASSERT(availableSize.height >= 0.0f);
 
@@ -579,7 +633,7 @@ _Check_return_ HRESULT ParagraphNode::MeasureCore(
         // complete the addition of line metrics and update paragraph metrics.
         if (addLineToMetrics)
         {
-            IFC(m_lines.Add(lineMetrics));
+            IFC(AddLineMetrics(lineMetrics));
             m_untrimmedDesiredWidth = MAX(m_untrimmedDesiredWidth, lineMetrics.Rect.Width);
             m_desiredSize.height += lineMetrics.VerticalAdvance;
             m_length += lineMetrics.Length;
@@ -616,6 +670,16 @@ _Check_return_ HRESULT ParagraphNode::MeasureCore(
             // since its part of metrics.
             pPreviousLineBreak = (pBreak == NULL) ? pTextLine->GetTextLineBreak() : NULL;
             pTextLine = NULL;
+
+            // Once the lines cover the first screens, or this frame's batch, leave the rest for a later Measure.
+            if (canDeferLines &&
+                pPreviousLineBreak != NULL &&
+                (m_desiredSize.height >= deferLinesAfterHeight || m_lines.GetCount() >= deferLinesAfterCount))
+            {
+                IFC(DeferRemainingLines(firstCharIndex + lineMetrics.Length, pPreviousLineBreak));
+                pPreviousLineBreak = NULL;
+                break;
+            }
         }
 
         firstCharIndex += lineMetrics.Length;
@@ -632,11 +696,103 @@ Cleanup:
     BlockLayoutHelpers::ReleaseTextFormatter(m_pBlockLayoutEngine->GetOwner(), pTextFormatter);
     ReleaseInterface(pBreak);
     ReleaseInterface(pParagraphProperties);
-    ReleaseInterface(pPreviousLineBreak);
+    if (pPreviousLineBreak != pResumedLineBreak)
+    {
+        ReleaseInterface(pPreviousLineBreak);
+    }
     ReleaseInterface(pTextLine);
+    ReleaseInterface(pResumedLineBreak);
     RRETURN(hr);
 }
 
+//---------------------------------------------------------------------------
+//
+// ParagraphNode::CanDeferLines
+//
+//  Synopsis:
+//      Whether the lines past the first screens of this paragraph can be
+//      formatted in later frames. Only whole RichTextBlock paragraphs
+//      measured without a height constraint qualify, since nothing else
+//      depends on where their lines end.
+//
+//---------------------------------------------------------------------------
+bool ParagraphNode::CanDeferLines(
+    _In_ XSIZEF availableSize,
+    _In_ XUINT32 paragraphMaxLines,
+    _In_ TextTrimming textTrimming,
+    _In_opt_ ParagraphNodeBreak *pPreviousBreak
+    ) const
+{
+    return m_pElement != NULL &&
+           pPreviousBreak == NULL &&
+           IsInfiniteF(availableSize.height) &&
+           paragraphMaxLines == 0 &&
+           textTrimming == DirectUI::TextTrimming::None &&
+           RuntimeFeatureBehavior::GetRuntimeEnabledFeatureDetector()->IsFeatureEnabled(RuntimeFeatureBehavior::RuntimeEnabledFeature::DeferOffscreenLineFormatting);
+}
+
+//---------------------------------------------------------------------------
+//
+// ParagraphNode::DeferRemainingLines
+//
+//  Synopsis:
+//      Stops formatting before nextCharIndex, adds an estimate of the height
+//      of the remaining lines to the desired size, and schedules another
+//      Measure to continue from pNextLineBreak.
+//
+//---------------------------------------------------------------------------
+_Check_return_ HRESULT ParagraphNode::DeferRemainingLines(
+    _In_ XUINT32 nextCharIndex,
+    _In_ TextLineBreak *pNextLineBreak
+    )
+{
+    XUINT32 paragraphLength = 0;
+    XUINT32 lineCount = m_lines.GetCount();
+    CTextCore *pTextCore = NULL;
+
+    ASSERT(m_pElement != NULL);
+    ASSERT(lineCount > 0);
+    ASSERT(m_length == nextCharIndex);
+
+    static_cast<CParagraph *>(m_pElement)->GetPositionCount(&paragraphLength);
+    XUINT32 remainingLength = (paragraphLength > nextCharIndex) ? (paragraphLength - nextCharIndex) : 0;
+
+    // Assume the rest of the paragraph wraps like the part formatted so far.
+    XFLOAT averageLineLength = MAX(1.0f, static_cast<XFLOAT>(nextCharIndex) / lineCount);
+    XFLOAT averageLineAdvance = m_desiredSize.height / lineCount;
+    m_deferredHeightEstimate = static_cast<XFLOAT>(XcpCeiling(remainingLength / averageLineLength)) * averageLineAdvance;
+
+    ReplaceInterface(m_pDeferredLineBreak, pNextLineBreak);
+    m_deferredCharIndex = nextCharIndex;
+
+    // The node still covers the whole paragraph, so positions in the blocks after it don't move.
+    m_desiredSize.height += m_deferredHeightEstimate;
+    m_length += remainingLength;
+    SetHasDeferredContent();
+
+    if (CFrameworkElement *pOwner = do_pointer_cast<CFrameworkElement>(m_pBlockLayoutEngine->GetOwner()))
+    {
+        IFC_RETURN(pOwner->GetContext()->GetTextCore(&pTextCore));
+        pTextCore->RegisterDeferredLineFormatting(pOwner);
+    }
+
+    return S_OK;
+}
+
+//---------------------------------------------------------------------------
+//
+// ParagraphNode::IsPositionDeferred
+//
+//  Synopsis:
+//      Whether the position falls in the part of the paragraph whose lines
+//      haven't been formatted yet.
+//
+//---------------------------------------------------------------------------
+bool ParagraphNode::IsPositionDeferred(_In_ XUINT32 positionInParagraph) const
+{
+    return m_pDeferredLineBreak != NULL && positionInParagraph >= m_deferredCharIndex;
+}
+
 //---------------------------------------------------------------------------
 //
 // ParagraphNode::ArrangeCore
@@ -906,6 +1062,21 @@ _Check_return_ HRESULT ParagraphNode::CanBypassMeasure(
         }
     }
 
+    if (m_pDeferredLineBreak != NULL)
+    {
+        // Lines were left for later. Continue formatting them if nothing that affects line breaking changed,
+        // otherwise format the paragraph again from the start.
+        m_resumeDeferredLines =
+            !IsMeasureDirty() &&
+            (IsEmptyContentAllowed() == allowEmptyContent) &&
+            (IsMeasureBottomless() == measureBottomless) &&
+            (m_cachedMaxLines == paragraphMaxLines) &&
+            BlockNodeBreak::Equals(pPreviousBreak, m_pPreviousBreak) &&
+            IsCloseReal(availableSize.width, m_prevAvailableSize.width) &&
+            IsInfiniteF(availableSize.height);
+        canBypassMeasure = false;
+    }
+
     *pCanBypass = canBypassMeasure;
 
 Cleanup:
@@ -927,6 +1098,47 @@ void ParagraphNode::DeleteLineCache()
     }
     m_lines.Clear();
     ReleaseInterface(m_pBreak);
+    ReleaseInterface(m_pDeferredLineBreak);
+    m_deferredCharIndex = 0;
+    m_deferredHeightEstimate = 0.0f;
+}
+
+//---------------------------------------------------------------------------
+//
+// ParagraphNode::AddLineMetrics
+//
+//  Synopsis:
+//      Appends a line to the line cache, filling in the running offsets that
+//      let GetLineIndexFromPosition and GetLineIndexFromPoint binary search
+//      the cache instead of walking it.
+//
+//---------------------------------------------------------------------------
+_Check_return_ HRESULT ParagraphNode::AddLineMetrics(
+    _In_ LineMetrics lineMetrics
+    )
+{
+    XUINT32 lineCount = m_lines.GetCount();
+
+    if (lineCount > 0)
+    {
+        const LineMetrics& previousLine = m_lines[lineCount - 1];
+
+        // Lines are contiguous, so FirstCharIndex is itself a running sum of line lengths.
+        ASSERT(lineMetrics.FirstCharIndex == previousLine.FirstCharIndex + previousLine.Length);
+        lineMetrics.VerticalOffset = previousLine.VerticalOffset + previousLine.VerticalAdvance;
+    }
+    else
+    {
+        lineMetrics.VerticalOffset = 0.0f;
+    }
+
+    lineMetrics.HitTestBottom = lineMetrics.VerticalOffset + lineMetrics.Rect.Y + lineMetrics.VerticalAdvance;
+    if (lineCount > 0)
+    {
+        lineMetrics.HitTestBottom = MAX(lineMetrics.HitTestBottom, m_lines[lineCount - 1].HitTestBottom);
+    }
+
+    return m_lines.Add(lineMetrics);
 }
 
 //---------------------------------------------------------------------------
@@ -1326,22 +1538,52 @@ XUINT32 ParagraphNode::GetLineIndexFromPosition(
     _Out_opt_ XPOINTF *pLineOffset
     ) const
 {
-    XPOINTF lineOffset = {0.0f, 0.0f};
-    for (XUINT32 i = 0; i < m_lines.GetCount(); i++)
+    XUINT32 lineCount = m_lines.GetCount();
+
+    // Find the last line starting at or before the position. Empty lines share their FirstCharIndex with
+    // the line that follows them, so this never lands on an empty line unless it is the last one.
+    XUINT32 low = 0;
+    XUINT32 high = lineCount;
+    while (low < high)
+    {
+        XUINT32 mid = low + (high - low) / 2;
+        if (m_lines[mid].FirstCharIndex <= positionInParagraph)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if (low > 0)
     {
-        if (m_lines[i].FirstCharIndex <= positionInParagraph &&
-            positionInParagraph < (m_lines[i].FirstCharIndex + m_lines[i].Length))
+        XUINT32 i = low - 1;
+        if (positionInParagraph < (m_lines[i].FirstCharIndex + m_lines[i].Length))
         {
             if (pLineOffset != NULL)
             {
-                *pLineOffset = lineOffset;
+                pLineOffset->x = 0.0f;
+                pLineOffset->y = m_lines[i].VerticalOffset;
             }
             return i;
         }
-        lineOffset.y += m_lines[i].VerticalAdvance;
     }
+
+    // Positions in lines that haven't been formatted yet map to the last formatted line.
+    if (lineCount > 0 && IsPositionDeferred(positionInParagraph))
+    {
+        if (pLineOffset != NULL)
+        {
+            pLineOffset->x = 0.0f;
+            pLineOffset->y = m_lines[lineCount - 1].VerticalOffset;
+        }
+        return lineCount - 1;
+    }
+
     ASSERT(FALSE);
-    return m_lines.GetCount();
+    return lineCount;
 }
 
 XUINT32 ParagraphNode::GetLineIndexFromPoint(
@@ -1350,30 +1592,36 @@ XUINT32 ParagraphNode::GetLineIndexFromPoint(
     ) const
 {
     XPOINTF lineOffset = {0.0f, 0.0f};
+    XUINT32 lineCount = m_lines.GetCount();
     XUINT32 i = 0;
 
-    for (i = 0; i < m_lines.GetCount(); i++)
+    // The true line's start along Y direction is the advance-based offset with adjustment
+    // for the line height/stacking strategy. Before start of first line - match to first line.
+    if (lineCount > 0 && !(point.y < m_lines[0].Rect.Y))
     {
-        // The true line's start along Y direction is the advance-based offset with adjustment
-        // for the line height/stacking strategy.
-        XFLOAT lineStartY = lineOffset.y + m_lines[i].Rect.Y;
-
-        if (point.y < lineStartY && i == 0 )
-        {
-            // Before start of first line - match to first line.
-            break;
-        }
-        else if (point.y < (lineStartY + m_lines[i].VerticalAdvance))
-        {
-            break;
-        }
-        else if (i == m_lines.GetCount() - 1)
+        // Match the first line whose bottom edge is below the point. Line height adjustments can make
+        // bottom edges non-monotonic, so search the running maximum instead; the first line where it
+        // exceeds the point is also the first line whose own bottom edge does.
+        XUINT32 low = 0;
+        XUINT32 high = lineCount;
+        while (low < high)
         {
-            // Past the end of the last line - match to last line.
-            break;
+            XUINT32 mid = low + (high - low) / 2;
+            if (point.y < m_lines[mid].HitTestBottom)
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
+            }
         }
-        lineOffset.y += m_lines[i].VerticalAdvance;
+
+        // Past the end of the last line - match to last line.
+        i = MIN(low, lineCount - 1);
+        lineOffset.y = m_lines[i].VerticalOffset;
     }
+
     *pLineOffset = lineOffset;
     return i;
 }
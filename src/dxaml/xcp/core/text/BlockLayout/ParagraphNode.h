@@ -11,6 +11,7 @@
 namespace RichTextServices
 {
     class TextLine;
+    class TextLineBreak;
 }
 
 class ParagraphNodeBreak;
@@ -105,8 +106,34 @@ private:
 
     bool m_hasTrimmedLine = false;
 
+    // A long paragraph measured without a height constraint only formats the lines covering its first
+    // screens, and estimates the height of the rest. Formatting continues from m_pDeferredLineBreak in
+    // later frames, each batch as large as everything formatted before it.
+    RichTextServices::TextLineBreak *m_pDeferredLineBreak = nullptr;
+    XUINT32 m_deferredCharIndex = 0;
+    XFLOAT m_deferredHeightEstimate = 0.0f;
+    bool m_resumeDeferredLines = false;
+
     void DeleteLineCache();
 
+    bool CanDeferLines(
+        _In_ XSIZEF availableSize,
+        _In_ XUINT32 paragraphMaxLines,
+        _In_ DirectUI::TextTrimming textTrimming,
+        _In_opt_ ParagraphNodeBreak *pPreviousBreak
+        ) const;
+
+    _Check_return_ HRESULT DeferRemainingLines(
+        _In_ XUINT32 nextCharIndex,
+        _In_ RichTextServices::TextLineBreak *pNextLineBreak
+        );
+
+    bool IsPositionDeferred(_In_ XUINT32 positionInParagraph) const;
+
+    _Check_return_ HRESULT AddLineMetrics(
+        _In_ LineMetrics lineMetrics
+        );
+
     _Check_return_ HRESULT EnsureTextCaches(
         _In_opt_ ParagraphNodeBreak *pPreviousBreak
         );
@@ -8,6 +8,20 @@ enum UcdProperty;
 // Ucd functions
 bool    UcdInitialize();
 
+// Bulk classification of UTF-16 text. Each output array receives one value per code unit of the text.
+void UcdLookupEnumeratedProperties(
+    _In_reads_(propertyCount) const UcdProperty* properties,
+    uint32_t propertyCount,
+    _In_reads_(length) const wchar_t* text,
+    uint32_t length,
+    _In_reads_(propertyCount) uint8_t* const* values);
+
+void UcdLookupEnumeratedProperty(
+    UcdProperty prop,
+    _In_reads_(length) const wchar_t* text,
+    uint32_t length,
+    _Out_writes_(length) uint8_t* values);
+
 // The binary data starts with a header and is followed by a variable-sized
 // array of property directory entries.
 //
@@ -11,22 +11,39 @@
 #define DEBUG_ASSERT(_x) ASSERT(_x)
 
 const char32_t UnicodeMax = 0x10FFFF;
+const char32_t Latin1Max = 0xFF;
 
 // Global pointer to ucd binary data used by the lookup functions below
 const UcdFileHeader * g_ucddata = nullptr;
 
+static int32_t UcdLookupEnumeratedPropertyInTable(UcdProperty prop, char32_t c);
+
+#if DBG
+static void UcdVerifyLookups();
+#endif
+
 // Initialize the global Ucd data pointer to the Ucd data in the resources
 bool UcdInitialize()
 {
     g_ucddata = reinterpret_cast<const UcdFileHeader*>(g_ucdDataBytes);
-    return g_ucddata != nullptr;
+
+    if (g_ucddata == nullptr)
+    {
+        return false;
+    }
+
+    DEBUG_ASSERT(g_ucddata->properties_count == g_ucdLatin1PropertyCount);
+
+#if DBG
+    UcdVerifyLookups();
+#endif
+
+    return true;
 }
 
-// General function for looking up enumerated properties.
-int32_t UcdLookupEnumeratedProperty(UcdProperty prop, char32_t c)
+// Walks the four-level lookup table of a property.
+static int32_t UcdLookupEnumeratedPropertyInTable(UcdProperty prop, char32_t c)
 {
-    DEBUG_ASSERT(c <= UnicodeMax);
-
     UcdPropertyInfo const* propinfo = &g_ucddata->properties[prop - 1];
     uint8_t b0 = (c >> (ChildBlockBits * 3)) & (ChildBlockLevels - 1);
     uint8_t b1 = (c >> (ChildBlockBits * 2)) & (ChildBlockLevels - 1);
@@ -42,3 +59,163 @@ int32_t UcdLookupEnumeratedProperty(UcdProperty prop, char32_t c)
 
     return v;
 }
+
+// General function for looking up enumerated properties.
+int32_t UcdLookupEnumeratedProperty(UcdProperty prop, char32_t c)
+{
+    DEBUG_ASSERT(c <= UnicodeMax);
+
+    if (c <= Latin1Max)
+    {
+        return g_ucdLatin1Properties[c * g_ucdLatin1PropertyCount + (prop - 1)];
+    }
+
+    return UcdLookupEnumeratedPropertyInTable(prop, c);
+}
+
+// Decodes the character starting at text[i], returning the number of code units it spans. Unpaired
+// surrogates are classified as themselves, as they are when passed to UcdLookupEnumeratedProperty.
+static uint32_t UcdDecodeCharacter(
+    _In_reads_(length) const wchar_t* text,
+    uint32_t length,
+    uint32_t i,
+    _Out_ char32_t* c)
+{
+    *c = text[i];
+
+    if (IS_LEADING_SURROGATE(*c) && (i + 1 < length) && IS_TRAILING_SURROGATE(text[i + 1]))
+    {
+        *c = ((*c & 0x3FF) << 10) + (text[i + 1] & 0x3FF) + 0x10000;
+        return 2;
+    }
+
+    return 1;
+}
+
+// Looks up a single enumerated property for every code unit of a UTF-16 run. Both code units of a
+// surrogate pair receive the value of the supplementary character.
+void UcdLookupEnumeratedProperty(
+    UcdProperty prop,
+    _In_reads_(length) const wchar_t* text,
+    uint32_t length,
+    _Out_writes_(length) uint8_t* values)
+{
+    const uint8_t* latin1Column = &g_ucdLatin1Properties[prop - 1];
+    uint32_t i = 0;
+
+    while (i < length)
+    {
+        // Latin-1 dominates most content, so classify runs of it straight from the packed table.
+        while (i < length && text[i] <= Latin1Max)
+        {
+            values[i] = latin1Column[text[i] * g_ucdLatin1PropertyCount];
+            i++;
+        }
+
+        if (i < length)
+        {
+            char32_t c;
+            uint32_t codeUnits = UcdDecodeCharacter(text, length, i, &c);
+            uint8_t value = static_cast<uint8_t>(UcdLookupEnumeratedPropertyInTable(prop, c));
+
+            for (uint32_t unit = 0; unit < codeUnits; unit++)
+            {
+                values[i++] = value;
+            }
+        }
+    }
+}
+
+// Looks up several enumerated properties for every code unit of a UTF-16 run, decoding the text once.
+// values[j] receives the values of properties[j].
+void UcdLookupEnumeratedProperties(
+    _In_reads_(propertyCount) const UcdProperty* properties,
+    uint32_t propertyCount,
+    _In_reads_(length) const wchar_t* text,
+    uint32_t length,
+    _In_reads_(propertyCount) uint8_t* const* values)
+{
+    uint32_t i = 0;
+
+    while (i < length)
+    {
+        char32_t c;
+        uint32_t codeUnits = UcdDecodeCharacter(text, length, i, &c);
+
+        if (c <= Latin1Max)
+        {
+            // Every property of a Latin-1 character is stored in a single row of the packed table.
+            const uint8_t* row = &g_ucdLatin1Properties[c * g_ucdLatin1PropertyCount];
+
+            for (uint32_t j = 0; j < propertyCount; j++)
+            {
+                values[j][i] = row[properties[j] - 1];
+            }
+        }
+        else
+        {
+            for (uint32_t j = 0; j < propertyCount; j++)
+            {
+                uint8_t value = static_cast<uint8_t>(UcdLookupEnumeratedPropertyInTable(properties[j], c));
+
+                for (uint32_t unit = 0; unit < codeUnits; unit++)
+                {
+                    values[j][i + unit] = value;
+                }
+            }
+        }
+
+        i += codeUnits;
+    }
+}
+
+#if DBG
+// Checks the packed Latin-1 table and the run lookups against the four-level tables they stand in for.
+// Beyond Latin-1 both lookups walk the same tables, so covering Latin-1 and the surrogate handling is exhaustive.
+static void UcdVerifyLookups()
+{
+    const wchar_t supplementary[] = { 0xD83D, 0xDE00, 0xD83D, L'a', 0xDE00, 0x0300, 0x3042 };
+    const uint32_t length = (Latin1Max + 1) + ARRAY_SIZE(supplementary);
+
+    wchar_t text[length];
+    for (uint32_t i = 0; i <= Latin1Max; i++)
+    {
+        text[i] = static_cast<wchar_t>(i);
+    }
+    memcpy(text + Latin1Max + 1, supplementary, sizeof(supplementary));
+
+    UcdProperty properties[TotalUcdProps - 1];
+    uint8_t valuesStorage[TotalUcdProps - 1][length];
+    uint8_t* values[TotalUcdProps - 1];
+
+    for (uint32_t j = 0; j < TotalUcdProps - 1; j++)
+    {
+        properties[j] = static_cast<UcdProperty>(j + 1);
+        values[j] = valuesStorage[j];
+    }
+
+    UcdLookupEnumeratedProperties(properties, TotalUcdProps - 1, text, length, values);
+
+    for (uint32_t j = 0; j < TotalUcdProps - 1; j++)
+    {
+        uint8_t singleValues[length];
+        UcdLookupEnumeratedProperty(properties[j], text, length, singleValues);
+
+        uint32_t i = 0;
+        while (i < length)
+        {
+            char32_t c;
+            uint32_t codeUnits = UcdDecodeCharacter(text, length, i, &c);
+            int32_t expected = UcdLookupEnumeratedPropertyInTable(properties[j], c);
+
+            ASSERT(UcdLookupEnumeratedProperty(properties[j], c) == expected);
+
+            for (uint32_t unit = 0; unit < codeUnits; unit++, i++)
+            {
+                ASSERT(values[j][i] == expected);
+                ASSERT(singleValues[i] == expected);
+            }
+        }
+    }
+}
+#endif
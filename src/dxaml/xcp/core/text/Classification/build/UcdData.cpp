@@ -4630,3 +4630,266 @@ const XUINT8 g_ucdDataBytes[] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     
 };
+
+const XUINT32 g_ucdLatin1PropertyCount = 9;
+
+// Indexed by (character * g_ucdLatin1PropertyCount) + (property - 1).
+const XUINT8 g_ucdLatin1Properties[] = 
+{
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0000
+    0x01, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0001
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0002
+    0x01, 0x7e, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0003
+    0x00, 0x30, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0004
+    0x01, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0005
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0006
+    0x01, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0007
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0008
+    0x01, 0x03, 0x01, 0x01, 0x03, 0x0c, 0x11, 0x00, 0x00, // U+0009
+    0x00, 0x00, 0x01, 0x01, 0x15, 0x0c, 0x02, 0x00, 0x00, // U+000A
+    0x01, 0x50, 0x01, 0x01, 0x05, 0x0c, 0x11, 0x00, 0x00, // U+000B
+    0x00, 0x00, 0x01, 0x01, 0x05, 0x0c, 0x12, 0x00, 0x00, // U+000C
+    0x01, 0x00, 0x01, 0x01, 0x09, 0x0c, 0x02, 0x00, 0x00, // U+000D
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+000E
+    0x01, 0x28, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+000F
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0010
+    0x01, 0x00, 0x08, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0011
+    0x00, 0x00, 0x01, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0012
+    0x01, 0xa8, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0013
+    0x00, 0x0d, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0014
+    0x01, 0x00, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0015
+    0x00, 0x00, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0016
+    0x01, 0x00, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0017
+    0x00, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0018
+    0x01, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0019
+    0x00, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+001A
+    0x01, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+001B
+    0x00, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x02, 0x00, 0x00, // U+001C
+    0x01, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x02, 0x00, 0x00, // U+001D
+    0x00, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x02, 0x00, 0x00, // U+001E
+    0x01, 0x08, 0x22, 0x01, 0x08, 0x0c, 0x11, 0x00, 0x00, // U+001F
+    0x00, 0x08, 0x22, 0x01, 0x1f, 0x0c, 0x12, 0x1d, 0x00, // U+0020
+    0x01, 0x08, 0x22, 0x01, 0x0a, 0x0c, 0x0c, 0x15, 0x00, // U+0021
+    0x00, 0x08, 0x22, 0x22, 0x1c, 0x0c, 0x0c, 0x15, 0x00, // U+0022
+    0x01, 0x08, 0x22, 0x22, 0x01, 0x0c, 0x07, 0x15, 0x00, // U+0023
+    0x00, 0x08, 0x22, 0x08, 0x1b, 0x0c, 0x07, 0x17, 0x00, // U+0024
+    0x01, 0x08, 0x22, 0x01, 0x1a, 0x0c, 0x07, 0x15, 0x00, // U+0025
+    0x00, 0x08, 0x22, 0x08, 0x01, 0x0c, 0x0c, 0x15, 0x00, // U+0026
+    0x01, 0x08, 0x22, 0x08, 0x1c, 0x0c, 0x0c, 0x15, 0x00, // U+0027
+    0x00, 0x08, 0x01, 0x08, 0x19, 0x0c, 0x0c, 0x16, 0x00, // U+0028
+    0x01, 0x08, 0x01, 0x08, 0x07, 0x0c, 0x0c, 0x12, 0x00, // U+0029
+    0x00, 0x08, 0x01, 0x08, 0x01, 0x0c, 0x0c, 0x15, 0x00, // U+002A
+    0x01, 0x08, 0x01, 0x08, 0x1b, 0x0c, 0x06, 0x19, 0x00, // U+002B
+    0x00, 0x08, 0x01, 0x08, 0x11, 0x0c, 0x04, 0x15, 0x00, // U+002C
+    0x01, 0x08, 0x01, 0x08, 0x0e, 0x0c, 0x06, 0x11, 0x00, // U+002D
+    0x00, 0x08, 0x01, 0x08, 0x11, 0x0c, 0x04, 0x15, 0x00, // U+002E
+    0x01, 0x08, 0x01, 0x08, 0x20, 0x0c, 0x04, 0x15, 0x00, // U+002F
+    0x00, 0x08, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0030
+    0x01, 0x08, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0031
+    0x00, 0x08, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0032
+    0x01, 0x09, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0033
+    0x00, 0x0a, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0034
+    0x01, 0x0b, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0035
+    0x00, 0x0c, 0x01, 0x22, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0036
+    0x01, 0x0d, 0x01, 0x22, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0037
+    0xc0, 0x08, 0x01, 0x01, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0038
+    0x00, 0x08, 0x01, 0x08, 0x18, 0x0c, 0x05, 0x0d, 0x00, // U+0039
+    0x20, 0x08, 0x01, 0x08, 0x11, 0x0c, 0x04, 0x15, 0x00, // U+003A
+    0x01, 0x08, 0x01, 0x08, 0x11, 0x0c, 0x0c, 0x15, 0x00, // U+003B
+    0x68, 0x08, 0x01, 0x08, 0x01, 0x0c, 0x0c, 0x19, 0x00, // U+003C
+    0x01, 0x08, 0x01, 0x22, 0x01, 0x0c, 0x0c, 0x19, 0x00, // U+003D
+    0x38, 0x08, 0x01, 0x22, 0x01, 0x0c, 0x0c, 0x19, 0x00, // U+003E
+    0x02, 0x08, 0x01, 0x22, 0x0a, 0x0c, 0x0c, 0x15, 0x00, // U+003F
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x0c, 0x0c, 0x15, 0x00, // U+0040
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0041
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0042
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0043
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0044
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0045
+    0x00, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0046
+    0x10, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0047
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0048
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0049
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004A
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004B
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004C
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004D
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004E
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+004F
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0050
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0051
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0052
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0053
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0054
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0055
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0056
+    0x24, 0x08, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0057
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0058
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+0059
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+005A
+    0x24, 0x00, 0x2f, 0x01, 0x19, 0x0c, 0x0c, 0x16, 0x00, // U+005B
+    0x24, 0x00, 0x2f, 0x01, 0x1b, 0x0c, 0x0c, 0x15, 0x00, // U+005C
+    0x24, 0x00, 0x2f, 0x01, 0x07, 0x0c, 0x0c, 0x12, 0x00, // U+005D
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x0c, 0x0c, 0x18, 0x00, // U+005E
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x0c, 0x0c, 0x10, 0x00, // U+005F
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x0c, 0x0c, 0x18, 0x00, // U+0060
+    0x08, 0x00, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0061
+    0x24, 0x00, 0x2f, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0062
+    0x24, 0x08, 0x2f, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0063
+    0x09, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0064
+    0x24, 0x00, 0x2f, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0065
+    0x0a, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0066
+    0x24, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0067
+    0x24, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0068
+    0x24, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0069
+    0x24, 0x20, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006A
+    0x0b, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006B
+    0x0c, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006C
+    0x0d, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006D
+    0x24, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006E
+    0x24, 0x00, 0x2f, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+006F
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0070
+    0x24, 0x80, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0071
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0072
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0073
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0074
+    0x24, 0x00, 0xfc, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0075
+    0x24, 0x00, 0x00, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0076
+    0x24, 0x00, 0x00, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0077
+    0x24, 0x00, 0x00, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0078
+    0x24, 0x02, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+0079
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+007A
+    0x24, 0x00, 0x1e, 0x08, 0x19, 0x0c, 0x0c, 0x16, 0x00, // U+007B
+    0x24, 0x00, 0x00, 0x08, 0x03, 0x0c, 0x0c, 0x19, 0x00, // U+007C
+    0x24, 0x00, 0x00, 0x22, 0x07, 0x0c, 0x0c, 0x12, 0x00, // U+007D
+    0x24, 0x00, 0x00, 0x22, 0x01, 0x0c, 0x0c, 0x19, 0x00, // U+007E
+    0x24, 0x00, 0x00, 0x22, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+007F
+    0x80, 0x08, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0080
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0081
+    0x80, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0082
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0083
+    0x80, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0084
+    0x00, 0x00, 0x00, 0x01, 0x16, 0x0c, 0x02, 0x00, 0x00, // U+0085
+    0x80, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0086
+    0x00, 0x00, 0x10, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0087
+    0x80, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0088
+    0x00, 0x01, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0089
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008A
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008B
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008C
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008D
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008E
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+008F
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0090
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0091
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0092
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0093
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0094
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0095
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0096
+    0x02, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0097
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0098
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+0099
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009A
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009B
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009C
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009D
+    0x80, 0x80, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009E
+    0x00, 0x00, 0x24, 0x01, 0x08, 0x0c, 0x03, 0x00, 0x00, // U+009F
+    0x80, 0x80, 0x24, 0x01, 0x0b, 0x0c, 0x04, 0x1d, 0x00, // U+00A0
+    0x00, 0x00, 0x08, 0x01, 0x19, 0x0c, 0x0c, 0x15, 0x00, // U+00A1
+    0x80, 0x80, 0x24, 0x22, 0x1a, 0x0c, 0x07, 0x17, 0x00, // U+00A2
+    0x00, 0x00, 0x24, 0x22, 0x1b, 0x0c, 0x07, 0x17, 0x00, // U+00A3
+    0x80, 0x80, 0x09, 0x08, 0x1b, 0x0c, 0x07, 0x17, 0x00, // U+00A4
+    0x00, 0x00, 0x24, 0x01, 0x1b, 0x0c, 0x07, 0x17, 0x00, // U+00A5
+    0x80, 0x80, 0x0a, 0x08, 0x01, 0x0c, 0x0c, 0x1a, 0x00, // U+00A6
+    0x00, 0x00, 0x24, 0x08, 0x00, 0x0c, 0x0c, 0x1a, 0x00, // U+00A7
+    0x80, 0x80, 0x24, 0x08, 0x00, 0x0c, 0x0c, 0x18, 0x00, // U+00A8
+    0x00, 0x00, 0x24, 0x08, 0x01, 0x0c, 0x0c, 0x1a, 0x00, // U+00A9
+    0x80, 0x80, 0x24, 0x08, 0x00, 0x26, 0x08, 0x05, 0x00, // U+00AA
+    0x00, 0x00, 0x0b, 0x08, 0x1c, 0x0c, 0x0c, 0x14, 0x00, // U+00AB
+    0x80, 0x80, 0x0c, 0x08, 0x01, 0x0c, 0x0c, 0x19, 0x00, // U+00AC
+    0x00, 0x00, 0x0d, 0x08, 0x03, 0x0c, 0x03, 0x01, 0x00, // U+00AD
+    0x80, 0x80, 0x24, 0x08, 0x01, 0x0c, 0x0c, 0x1a, 0x00, // U+00AE
+    0x00, 0x00, 0x24, 0x08, 0x01, 0x0c, 0x0c, 0x18, 0x00, // U+00AF
+    0x80, 0x80, 0x24, 0x08, 0x1a, 0x0c, 0x07, 0x1a, 0x00, // U+00B0
+    0x00, 0x00, 0x24, 0x08, 0x1b, 0x0c, 0x07, 0x19, 0x00, // U+00B1
+    0xd8, 0x80, 0x24, 0x08, 0x00, 0x0c, 0x05, 0x0f, 0x00, // U+00B2
+    0x02, 0x00, 0x24, 0x08, 0x00, 0x0c, 0x05, 0x0f, 0x00, // U+00B3
+    0x80, 0x80, 0x24, 0x08, 0x04, 0x0c, 0x0c, 0x18, 0x00, // U+00B4
+    0x00, 0x00, 0x24, 0x08, 0x01, 0x0c, 0x08, 0x05, 0x00, // U+00B5
+    0x80, 0x80, 0x24, 0x22, 0x00, 0x0c, 0x0c, 0x1a, 0x00, // U+00B6
+    0x00, 0x00, 0x24, 0x22, 0x00, 0x0c, 0x0c, 0x15, 0x00, // U+00B7
+    0x80, 0x80, 0x24, 0x01, 0x00, 0x0c, 0x0c, 0x18, 0x00, // U+00B8
+    0x00, 0x00, 0x24, 0x08, 0x00, 0x0c, 0x05, 0x0f, 0x00, // U+00B9
+    0x80, 0x80, 0x24, 0x08, 0x00, 0x26, 0x08, 0x05, 0x00, // U+00BA
+    0x00, 0x00, 0x24, 0x08, 0x1c, 0x0c, 0x0c, 0x13, 0x00, // U+00BB
+    0x80, 0x80, 0x24, 0x08, 0x00, 0x0c, 0x0c, 0x0f, 0x00, // U+00BC
+    0x00, 0x00, 0x24, 0x22, 0x00, 0x0c, 0x0c, 0x0f, 0x00, // U+00BD
+    0x80, 0x80, 0x24, 0x22, 0x00, 0x0c, 0x0c, 0x0f, 0x00, // U+00BE
+    0x00, 0x00, 0x24, 0x22, 0x19, 0x0c, 0x0c, 0x15, 0x00, // U+00BF
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C0
+    0x00, 0x22, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C1
+    0x00, 0x22, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C2
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C3
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C4
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C5
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C6
+    0x10, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C7
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C8
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00C9
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CA
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CB
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CC
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CD
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CE
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00CF
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D0
+    0x24, 0x01, 0x08, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D1
+    0x24, 0x01, 0x01, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D2
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D3
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D4
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D5
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D6
+    0x24, 0x01, 0x22, 0x01, 0x00, 0x0c, 0x0c, 0x19, 0x00, // U+00D7
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D8
+    0x24, 0x22, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00D9
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00DA
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00DB
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00DC
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00DD
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x09, 0x00, // U+00DE
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00DF
+    0x24, 0x01, 0x22, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E0
+    0x08, 0x22, 0x22, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E1
+    0x24, 0x01, 0x22, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E2
+    0x24, 0x22, 0x22, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E3
+    0x09, 0x22, 0x22, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E4
+    0x24, 0x22, 0x22, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E5
+    0x0a, 0x01, 0x22, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E6
+    0x24, 0x01, 0x22, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E7
+    0x24, 0x01, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E8
+    0x24, 0x01, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00E9
+    0x24, 0x22, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00EA
+    0x0b, 0x22, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00EB
+    0x0c, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00EC
+    0x0d, 0x01, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00ED
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00EE
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00EF
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F0
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F1
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F2
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F3
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F4
+    0x24, 0x22, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F5
+    0x24, 0x22, 0x01, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F6
+    0x24, 0x08, 0x01, 0x22, 0x00, 0x0c, 0x0c, 0x19, 0x00, // U+00F7
+    0x24, 0x08, 0x01, 0x01, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F8
+    0x24, 0x22, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00F9
+    0x24, 0x22, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FA
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FB
+    0x24, 0x08, 0x01, 0x08, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FC
+    0x24, 0x08, 0x01, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FD
+    0x24, 0x01, 0x01, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FE
+    0x24, 0x22, 0x01, 0x22, 0x01, 0x26, 0x08, 0x05, 0x00, // U+00FF
+};
@@ -3,6 +3,10 @@
 
 ###   UcdDataToPl - read in the ucd data binary file and emit it as a cpp with
 #     the data as an initialized array.
+#
+#     Also emits g_ucdLatin1Properties, the values of every property for
+#     U+0000..U+00FF packed one row per character, so that lookups of the
+#     most common characters don't need to walk the per-property tries.
 
 use strict;
 use Fcntl;
@@ -17,6 +21,8 @@ print "Reading binary classification data from '$inputBin'.\n";
 print "Writing c++ formatted data to '$outputCpp'.\n";
 
 
+print CPP "// Copyright (c) Microsoft Corporation. All rights reserved.\n";
+print CPP "// Licensed under the MIT License. See LICENSE in the project root for license information.\n";
 print CPP "//+----------------------------------------------------------------------------\n";
 print CPP "//\n";
 print CPP "//  This file was generated by UcdDataToCpp.pl\n";
@@ -38,11 +44,13 @@ print CPP "{\n";
 my $bytes      = "";
 my $nBytes     = 0;
 my $totalBytes = 0;
+my $data       = "";
 
 do
 {
     $nBytes = sysread(BIN, $bytes, 16);
     $totalBytes += $nBytes;
+    $data .= $bytes;
 
     print CPP "    ";
 
@@ -57,6 +65,39 @@ do
 
 close(BIN);
 
+print CPP "};\n";
+
+# Walk the lookup tries for U+0000..U+00FF the same way UcdLookupEnumeratedProperty
+# does. The top two levels of the trie are always indexed by 0 for these characters.
+
+my $childBlockBits   = 6;
+my $childBlockLevels = 1 << $childBlockBits;
+my $propertyCount    = unpack("V", substr($data, 0, 4));
+
+print CPP "\n";
+print CPP "const XUINT32 g_ucdLatin1PropertyCount = $propertyCount;\n";
+print CPP "\n";
+print CPP "// Indexed by (character * g_ucdLatin1PropertyCount) + (property - 1).\n";
+print CPP "const XUINT8 g_ucdLatin1Properties[] = \n";
+print CPP "{\n";
+
+for (my $c = 0; $c < 256; $c++)
+{
+    print CPP "    ";
+
+    for (my $prop = 0; $prop < $propertyCount; $prop++)
+    {
+        my $p = unpack("V", substr($data, 4 + (8 * $prop) + 4, 4));
+        $p += unpack("v", substr($data, $p, 2));
+        $p += unpack("v", substr($data, $p, 2));
+        $p += ord(substr($data, $p + ($c >> $childBlockBits), 1)) * $childBlockLevels;
+
+        printf CPP "0x%02x, ", ord(substr($data, $p + ($c & ($childBlockLevels - 1)), 1));
+    }
+
+    printf CPP "// U+%04X\n", $c;
+}
+
 print CPP "};\n";
 close(CPP);
 
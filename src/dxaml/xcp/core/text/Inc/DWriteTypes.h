@@ -29,6 +29,8 @@ typedef XUINT32 UINT32;
 //------------------------------------------------------------------------
 
 extern const XUINT8 g_ucdDataBytes[];
+extern const XUINT32 g_ucdLatin1PropertyCount;
+extern const XUINT8 g_ucdLatin1Properties[];
 
 // Creates an OpenType tag as a 32bit integer such that
 // the first character in the tag is the lowest byte,
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <xstring_ptr.h>
+#include <dwrite.h>
+#include <unordered_map>
+
+//------------------------------------------------------------------------
+//
+//  Class:  TextBlockMeasureCache
+//
+//  Synopsis:
+//      Remembers the IDWriteTextLayout metrics of the TextBlocks that take
+//  the DWrite fast path, so TextBlocks showing the same short string in the
+//  same formatting, like the labels in a long list, don't each format a
+//  layout just to find out their desired size. Everything that goes into
+//  formatting the layout is part of the key. One of these exists for each
+//  UI thread.
+//
+//------------------------------------------------------------------------
+
+class TextBlockMeasureCache
+{
+public:
+    struct Key
+    {
+        xstring_ptr Text;
+        xstring_ptr FontFamily;
+        xstring_ptr Language;
+        xstring_ptr LanguageList;
+        float FontSize;
+        float ScaledFontSize;
+        float Baseline;
+        float LineAdvance;
+        float AvailableWidth;       // Infinite when the width doesn't change the metrics.
+        float AvailableHeight;      // Infinite when the height doesn't change the metrics.
+        XUINT32 MaxLines;
+        XUINT16 FontWeight;
+        XUINT8 FontStyle;
+        XUINT8 FontStretch;
+        XUINT8 FlowDirection;
+        XUINT8 TextReadingOrder;
+        XUINT8 TextAlignment;
+        XUINT8 TextWrapping;
+        XUINT8 TextTrimming;
+        XUINT8 OpticalMarginAlignment;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct Statistics
+    {
+        XUINT32 EntryCount;
+        XUINT32 HitCount;
+        XUINT32 MissCount;
+        XUINT32 FlushCount;     // Number of times the table was emptied because it was full.
+    };
+
+    // Whether a TextBlock with this text can use the cache at all.
+    static bool CanCache(_In_ const xstring_ptr_view& strText);
+
+    bool TryGetMetrics(_In_ const Key& key, _Out_ DWRITE_TEXT_METRICS* pMetrics);
+    void AddMetrics(_In_ const Key& key, _In_ const DWRITE_TEXT_METRICS& metrics);
+
+    // Drops the metrics measured so far, for when the fonts they were measured with change.
+    void Clear();
+
+    Statistics GetStatistics() const;
+
+private:
+    struct KeyHasher
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    // Long strings are usually paragraphs rather than repeated labels.
+    static constexpr XUINT32 c_maxCachedTextLength = 256;
+    static constexpr size_t c_maxEntries = 2048;
+
+    std::unordered_map<Key, DWRITE_TEXT_METRICS, KeyHasher> m_entries;
+
+    XUINT32 m_hitCount = 0;
+    XUINT32 m_missCount = 0;
+    XUINT32 m_flushCount = 0;
+};
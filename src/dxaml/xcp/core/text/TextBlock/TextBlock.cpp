@@ -36,6 +36,7 @@
 #include <fonts.h>
 #include <DWriteTextAnalyzer.h>
 #include "RootScale.h"
+#include "TextBlockMeasureCache.h"
 
 #include <TextAnalysis.h>
 
@@ -85,6 +86,7 @@ CTextBlock::CTextBlock(_In_ CCoreServices *pCore)
     m_fFastPathOptOutConditions = 0;
     m_hasBeenMeasured = FALSE;
     m_isDWriteTextLayoutDirty = FALSE;
+    m_isDWriteTextLayoutDeferred = FALSE;
 
     // Fields common to TextBlock and RichTextBlock
     m_eLineHeight = 0.0f; //implies no line height override
@@ -743,6 +745,8 @@ _Check_return_ HRESULT CTextBlock::GetActualWidth(_Out_ float* pWidth)
     *pWidth = 0;
     if (m_textMode == TextMode::DWriteLayout)
     {
+        IFC_RETURN(EnsureDWriteTextLayout());
+
         if (m_pTextLayout)
         {
             DWRITE_TEXT_METRICS m = {};
@@ -772,6 +776,8 @@ _Check_return_ HRESULT CTextBlock::GetActualHeight(_Out_ float* pHeight)
     *pHeight = 0;
     if (m_textMode == TextMode::DWriteLayout)
     {
+        IFC_RETURN(EnsureDWriteTextLayout());
+
         if (m_pTextLayout)
         {
             DWRITE_TEXT_METRICS m = {};
@@ -840,6 +846,8 @@ _Check_return_ HRESULT CTextBlock::GetBaselineOffset(_Out_ float *pBaselineOffse
 
     if (m_textMode == TextMode::DWriteLayout)
     {
+        IFC_RETURN(EnsureDWriteTextLayout());
+
         if (m_pTextLayout)
         {
             DWRITE_TEXT_METRICS m = {};
@@ -1621,6 +1629,119 @@ _Check_return_ HRESULT CTextBlock::GetLineHeight(_Out_ float* baseline, _Out_ fl
 }
 
 
+// Builds the TextBlockMeasureCache key from everything ConfigureDWriteTextLayout formats the layout with.
+static _Check_return_ HRESULT GetMeasureCacheKey(
+    _In_ CTextBlock* pTextBlock,
+    const XSIZEF availableSize,
+    const float baseline,
+    const float lineAdvance,
+    _Out_ TextBlockMeasureCache::Key* pKey)
+{
+    const TextFormatting* pTextFormatting = nullptr;
+    IFC_RETURN(pTextBlock->GetTextFormatting(&pTextFormatting));
+
+    // Without wrapping or trimming, the size of the layout box doesn't change the width and height
+    // of the text, so TextBlocks measured with different constraints can still share them.
+    const bool dependsOnWidth =
+        pTextBlock->m_textWrapping != DirectUI::TextWrapping::NoWrap ||
+        pTextBlock->m_textTrimming != DirectUI::TextTrimming::None;
+    const bool dependsOnHeight =
+        pTextBlock->m_textTrimming != DirectUI::TextTrimming::None ||
+        pTextBlock->m_maxLines != 0;
+
+    pKey->Text = pTextBlock->m_strText;
+    IFC_RETURN(pTextFormatting->m_pFontFamily->get_Source(&pKey->FontFamily));
+    pKey->Language = pTextFormatting->m_strLanguageString;
+    pKey->LanguageList = pTextFormatting->GetResolvedLanguageListStringNoRef();
+    pKey->FontSize = pTextFormatting->m_eFontSize;
+    pKey->ScaledFontSize = pTextFormatting->GetScaledFontSize(pTextBlock->GetContext()->GetFontScale());
+    pKey->Baseline = baseline;
+    pKey->LineAdvance = lineAdvance;
+    pKey->AvailableWidth = dependsOnWidth ? availableSize.width : XFLOAT_INF;
+    pKey->AvailableHeight = dependsOnHeight ? availableSize.height : XFLOAT_INF;
+    pKey->MaxLines = pTextBlock->m_maxLines;
+    pKey->FontWeight = static_cast<XUINT16>(pTextFormatting->m_nFontWeight);
+    pKey->FontStyle = static_cast<XUINT8>(pTextFormatting->m_nFontStyle);
+    pKey->FontStretch = static_cast<XUINT8>(pTextFormatting->m_nFontStretch);
+    pKey->FlowDirection = static_cast<XUINT8>(pTextFormatting->m_nFlowDirection);
+    pKey->TextReadingOrder = static_cast<XUINT8>(pTextBlock->m_textReadingOrder);
+    pKey->TextAlignment = static_cast<XUINT8>(pTextBlock->m_textAlignment);
+    pKey->TextWrapping = static_cast<XUINT8>(pTextBlock->m_textWrapping);
+    pKey->TextTrimming = static_cast<XUINT8>(pTextBlock->m_textTrimming);
+    pKey->OpticalMarginAlignment = static_cast<XUINT8>(pTextBlock->m_opticalMarginAlignment);
+
+    return S_OK;
+}
+
+// Formats the IDWriteTextLayout for the available size and gets its metrics, including the MaxLines trimming.
+_Check_return_ HRESULT CTextBlock::FormatDWriteTextLayout(
+    const XSIZEF availableSize,
+    const float baseline,
+    const float lineAdvance,
+    _Out_ DWRITE_TEXT_METRICS* pTextMetrics)
+{
+    m_isDWriteTextLayoutDeferred = FALSE;
+
+    IFC_RETURN(ConfigureDWriteTextLayout(availableSize, baseline, lineAdvance));
+
+    ASSERT(m_pTextLayout);
+
+    DWRITE_TEXT_METRICS textMetrics = {};
+    IFC_RETURN(m_pTextLayout->GetMetrics(&textMetrics));
+
+    // hack for MaxLines Property. Calcuate total line height for m_maxLines lines, then trim it.
+    if (m_maxLines != 0 && m_maxLines < textMetrics.lineCount)
+    {
+        uint32_t actualLineCount = 0;
+        float maxHeight = 0;
+
+        std::vector<DWRITE_LINE_METRICS> lineInformation(textMetrics.lineCount);
+
+        IFC_RETURN(m_pTextLayout->GetLineMetrics(lineInformation.data(), textMetrics.lineCount, &actualLineCount));
+        for (uint32_t index = 0; index < m_maxLines; index++)
+        {
+            maxHeight += lineInformation[index].height;
+        }
+
+        IFC_RETURN(m_pTextLayout->SetMaxHeight(maxHeight));
+
+        // When MaxLines is smaller than the actual line count, we need to ask DWriteTextLayout to trim the text if
+        // TextTrimming == DirectUI::TextTrimming::None. The default granularity is word.
+        if (m_textTrimming == DirectUI::TextTrimming::None)
+        {
+            DWRITE_TRIMMING trimmingOptions;
+            trimmingOptions = {
+                DWRITE_TRIMMING_GRANULARITY_CHARACTER,
+                0, // delimiter
+                0  // delimiter occurrence
+            };
+
+            IFC_RETURN(m_pTextLayout->SetTrimming(&trimmingOptions, nullptr));
+        }
+
+        IFC_RETURN(m_pTextLayout->GetMetrics(&textMetrics));
+    }
+
+    *pTextMetrics = textMetrics;
+    return S_OK;
+}
+
+// Formats the layout that MeasureOverride skipped because the TextBlockMeasureCache had its metrics.
+_Check_return_ HRESULT CTextBlock::EnsureDWriteTextLayout()
+{
+    if (m_isDWriteTextLayoutDeferred && m_textMode == TextMode::DWriteLayout)
+    {
+        float baseline;
+        float lineAdvance;
+        IFC_RETURN(GetLineHeight(&baseline, &lineAdvance));
+
+        DWRITE_TEXT_METRICS textMetrics;
+        IFC_RETURN(FormatDWriteTextLayout(m_deferredTextLayoutSize, baseline, lineAdvance, &textMetrics));
+    }
+
+    return S_OK;
+}
+
 //------------------------------------------------------------------------
 //
 //  Method:   CTextBlock::MeasureOverride
@@ -1646,6 +1767,8 @@ _Check_return_ HRESULT CTextBlock::MeasureOverride(
             m_isDWriteTextLayoutDirty = FALSE;
         }
 
+        m_isDWriteTextLayoutDeferred = FALSE;
+
         // Get line bounds
         float baseline;
         float lineAdvance;
@@ -1666,44 +1789,35 @@ _Check_return_ HRESULT CTextBlock::MeasureOverride(
         availableSize.width  = MAX(availableSize.width, 0);
         availableSize.height = MAX(availableSize.height, 0);
 
-        IFC_RETURN(ConfigureDWriteTextLayout(availableSize, baseline, lineAdvance));
-
-        ASSERT(m_pTextLayout);
-
         DWRITE_TEXT_METRICS textMetrics = {};
-        IFC_RETURN(m_pTextLayout->GetMetrics(&textMetrics));
+        TextBlockMeasureCache* pMeasureCache = nullptr;
+        TextBlockMeasureCache::Key measureCacheKey = {};
 
-        // hack for MaxLines Property. Calcuate total line height for m_maxLines lines, then trim it.
-        if (m_maxLines != 0 && m_maxLines < textMetrics.lineCount)
+        // Custom typography isn't part of the key.
+        if (TextBlockMeasureCache::CanCache(m_strText) &&
+            m_pInheritedProperties->m_typography.IsTypographyDefault())
         {
-            uint32_t actualLineCount = 0;
-            float maxHeight = 0;
-
-            std::vector<DWRITE_LINE_METRICS> lineInformation(textMetrics.lineCount);
-
-            IFC_RETURN(m_pTextLayout->GetLineMetrics(lineInformation.data(), textMetrics.lineCount, &actualLineCount));
-            for (uint32_t index = 0; index < m_maxLines; index++)
-            {
-                maxHeight += lineInformation[index].height;
-            }
+            pMeasureCache = GetContext()->GetTextBlockMeasureCache();
+            IFC_RETURN(GetMeasureCacheKey(this, availableSize, baseline, lineAdvance, &measureCacheKey));
+        }
 
-            IFC_RETURN(m_pTextLayout->SetMaxHeight(maxHeight));
+        if (pMeasureCache != nullptr && pMeasureCache->TryGetMetrics(measureCacheKey, &textMetrics))
+        {
+            // The layout isn't needed until the TextBlock is arranged, and TextBlocks that are
+            // only measured, like the ones a virtualizing panel estimates its extent with, never
+            // need it.
+            m_pTextLayout = nullptr;
+            m_isDWriteTextLayoutDeferred = TRUE;
+            m_deferredTextLayoutSize = availableSize;
+        }
+        else
+        {
+            IFC_RETURN(FormatDWriteTextLayout(availableSize, baseline, lineAdvance, &textMetrics));
 
-            // When MaxLines is smaller than the actual line count, we need to ask DWriteTextLayout to trim the text if
-            // TextTrimming == DirectUI::TextTrimming::None. The default granularity is word.
-            if (m_textTrimming == DirectUI::TextTrimming::None)
+            if (pMeasureCache != nullptr)
             {
-                DWRITE_TRIMMING trimmingOptions;
-                trimmingOptions = {
-                    DWRITE_TRIMMING_GRANULARITY_CHARACTER,
-                    0, // delimiter
-                    0  // delimiter occurrence
-                };
-
-                IFC_RETURN(m_pTextLayout->SetTrimming(&trimmingOptions, nullptr));
+                pMeasureCache->AddMetrics(measureCacheKey, textMetrics);
             }
-
-            IFC_RETURN(m_pTextLayout->GetMetrics(&textMetrics));
         }
 
         // Calculate the bottom adjustment for LineStackingStrategy.BaselineToBaseline && LineHeight  > 0.
@@ -1784,6 +1898,8 @@ _Check_return_ HRESULT CTextBlock::ArrangeOverride(
         {
             float lineStackingOffset;
 
+            IFC_RETURN(EnsureDWriteTextLayout());
+
             // Fast path for empty TextBlock.
             if (m_strText.GetCount() == 0)
             {
@@ -1944,6 +2060,7 @@ _Check_return_ HRESULT CTextBlock::UpdateIsTextTrimmedFastPath(_In_opt_ DWRITE_T
     {
         std::vector<DWRITE_LINE_METRICS> lineInformation(m->lineCount);
         uint32_t actualLineCount = 0;
+        IFC_RETURN(EnsureDWriteTextLayout());
         IFC_RETURN(m_pTextLayout->GetLineMetrics(lineInformation.data(), m->lineCount, &actualLineCount));
 
         ASSERT(actualLineCount != 0); // Line count formatted by DWrite will never be 0. Even an empty TextBlock will have 1 line.
@@ -3024,6 +3141,7 @@ _Check_return_ HRESULT CTextBlock::ResolveTextMode()
             IFC_RETURN(DeferredCreateInlineCollection());
             m_textMode = TextMode::Normal;
             m_pTextLayout = nullptr;
+            m_isDWriteTextLayoutDeferred = FALSE;
             m_pTextDrawingContext.reset();
         }
     }
@@ -3105,6 +3223,7 @@ _Check_return_ HRESULT CTextBlock::GetContentRenderTransform(_Out_ CMILMatrix* p
     if (pTextFormatting->m_nFlowDirection == DirectUI::FlowDirection::RightToLeft)
     {
         DWRITE_TEXT_METRICS m = {};
+        IFC_RETURN(EnsureDWriteTextLayout());
         IFC_RETURN(m_pTextLayout->GetMetrics(&m));
         pContentRenderTransform->SetM11(-1);
         pContentRenderTransform->SetDx(m.layoutWidth);
@@ -3190,8 +3309,9 @@ _Check_return_ HRESULT CTextBlock::GetLineStackingOffset(_In_ uint32_t lineCount
     return S_OK;
 }
 
-_Check_return_ HRESULT CTextBlock::GetDWriteTextLayout(_Out_ IDWriteTextLayout** textLayout) const
+_Check_return_ HRESULT CTextBlock::GetDWriteTextLayout(_Out_ IDWriteTextLayout** textLayout)
 {
+    IFC_RETURN(EnsureDWriteTextLayout());
     IFC_RETURN(m_pTextLayout.CopyTo(textLayout));
     return S_OK;
 }
@@ -3232,6 +3352,8 @@ _Check_return_ HRESULT CTextBlock::GetDWriteTextMetricsOffset(_Out_ XPOINTF* off
 {
     *offset = {0,0};
     ASSERT(m_textMode == TextMode::DWriteLayout);
+    IFC_RETURN(EnsureDWriteTextLayout());
+
     if (m_pTextLayout)
     {
         DWRITE_TEXT_METRICS m = {};
@@ -3427,6 +3549,7 @@ _Check_return_ HRESULT CTextBlock::RedrawText()
         DirectUI::FlowDirection flowDirection;
         IFC_RETURN(GetFlowDirection(&flowDirection));
         m_pTextDrawingContext->SetFlipSelectionAlongHorizontalAxis(flowDirection == DirectUI::FlowDirection::RightToLeft);
+        IFC_RETURN(EnsureDWriteTextLayout());
         IFC_RETURN(m_pTextLayout->Draw(nullptr, &dWriteRenderer, 0, 0));
     }
     else
@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "TextBlockMeasureCache.h"
+
+namespace
+{
+    template <typename T>
+    void HashCombine(_Inout_ std::size_t& hash, const T& value)
+    {
+        hash ^= std::hash<T>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+}
+
+bool TextBlockMeasureCache::Key::operator==(const Key& other) const
+{
+    return FontSize == other.FontSize
+        && ScaledFontSize == other.ScaledFontSize
+        && Baseline == other.Baseline
+        && LineAdvance == other.LineAdvance
+        && AvailableWidth == other.AvailableWidth
+        && AvailableHeight == other.AvailableHeight
+        && MaxLines == other.MaxLines
+        && FontWeight == other.FontWeight
+        && FontStyle == other.FontStyle
+        && FontStretch == other.FontStretch
+        && FlowDirection == other.FlowDirection
+        && TextReadingOrder == other.TextReadingOrder
+        && TextAlignment == other.TextAlignment
+        && TextWrapping == other.TextWrapping
+        && TextTrimming == other.TextTrimming
+        && OpticalMarginAlignment == other.OpticalMarginAlignment
+        && Text.Equals(other.Text)
+        && FontFamily.Equals(other.FontFamily)
+        && Language.Equals(other.Language)
+        && LanguageList.Equals(other.LanguageList);
+}
+
+std::size_t TextBlockMeasureCache::KeyHasher::operator()(const Key& key) const
+{
+    std::size_t hash = key.Text.GetHash();
+
+    HashCombine(hash, key.FontFamily);
+    HashCombine(hash, key.Language);
+    HashCombine(hash, key.LanguageList);
+    HashCombine(hash, key.FontSize);
+    HashCombine(hash, key.ScaledFontSize);
+    HashCombine(hash, key.Baseline);
+    HashCombine(hash, key.LineAdvance);
+    HashCombine(hash, key.AvailableWidth);
+    HashCombine(hash, key.AvailableHeight);
+    HashCombine(hash, key.MaxLines);
+    HashCombine(hash,
+        static_cast<XUINT32>(key.FontWeight) |
+        static_cast<XUINT32>(key.FontStyle) << 16 |
+        static_cast<XUINT32>(key.FontStretch) << 24);
+    HashCombine(hash,
+        static_cast<XUINT32>(key.FlowDirection) |
+        static_cast<XUINT32>(key.TextReadingOrder) << 8 |
+        static_cast<XUINT32>(key.TextAlignment) << 16 |
+        static_cast<XUINT32>(key.TextWrapping) << 24);
+    HashCombine(hash,
+        static_cast<XUINT32>(key.TextTrimming) |
+        static_cast<XUINT32>(key.OpticalMarginAlignment) << 8);
+
+    return hash;
+}
+
+bool TextBlockMeasureCache::CanCache(_In_ const xstring_ptr_view& strText)
+{
+    return !strText.IsNullOrEmpty() && strText.GetCount() <= c_maxCachedTextLength;
+}
+
+bool TextBlockMeasureCache::TryGetMetrics(_In_ const Key& key, _Out_ DWRITE_TEXT_METRICS* pMetrics)
+{
+    auto itr = m_entries.find(key);
+
+    if (itr == m_entries.end())
+    {
+        *pMetrics = {};
+        ++m_missCount;
+        return false;
+    }
+
+    *pMetrics = itr->second;
+    ++m_hitCount;
+    return true;
+}
+
+void TextBlockMeasureCache::AddMetrics(_In_ const Key& key, _In_ const DWRITE_TEXT_METRICS& metrics)
+{
+    ASSERT(CanCache(key.Text));
+
+    // Entries aren't ordered by use, so start over rather than guessing which ones to keep.
+    if (m_entries.size() >= c_maxEntries)
+    {
+        m_entries.clear();
+        ++m_flushCount;
+    }
+
+    m_entries.emplace(key, metrics);
+}
+
+void TextBlockMeasureCache::Clear()
+{
+    m_entries.clear();
+}
+
+TextBlockMeasureCache::Statistics TextBlockMeasureCache::GetStatistics() const
+{
+    Statistics statistics = {};
+
+    statistics.EntryCount = static_cast<XUINT32>(m_entries.size());
+    statistics.HitCount = m_hitCount;
+    statistics.MissCount = m_missCount;
+    statistics.FlushCount = m_flushCount;
+
+    return statistics;
+}
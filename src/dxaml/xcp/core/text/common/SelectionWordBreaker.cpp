@@ -11,15 +11,20 @@
 
 using namespace RichTextServices;
 
-//  Returns whether the passed character is considered a punctuation or symbol character
-_Check_return_ XCP_FORCEINLINE XINT32 IsXamlPunctuationOrSymbol(XUINT32 character)
+//  Returns whether the passed general category is a punctuation or symbol category
+_Check_return_ XCP_FORCEINLINE bool IsPunctuationOrSymbolCategory(GeneralCategory category)
 {
-    auto category = UcdGetGeneralCategory(character);
     // This encompasses the following categories:
     // Pc, Pd, Pe, Pf, Pi, Po, Ps, Sc, Sk, Sm, So
     return (category >= GeneralCategoryPc) && (category <= GeneralCategorySo);
 }
 
+//  Returns whether the passed character is considered a punctuation or symbol character
+_Check_return_ XCP_FORCEINLINE XINT32 IsXamlPunctuationOrSymbol(XUINT32 character)
+{
+    return IsPunctuationOrSymbolCategory(UcdGetGeneralCategory(character));
+}
+
 
 // The text backing store navigator is used to retrieve text content by walking the content tree.
 // The class supports navigation of both the TextBox and RichText backing stores.
@@ -158,6 +163,49 @@ private:
 };
 
 
+// The general categories of a text container's text, looked up for the whole text in one pass.
+class CTextCategories
+{
+public:
+    CTextCategories(_In_reads_(length) const wchar_t* text, uint32_t length)
+        : m_text(text)
+        , m_categories(length)
+    {
+        UcdLookupEnumeratedProperty(UcdPropGeneralCategory, text, length, m_categories.data());
+    }
+
+    // Whether the character at the navigator's position is a punctuation or symbol character. Falls back to
+    // looking the character up if the position doesn't map to it in the text, e.g. at the end of a paragraph.
+    bool IsPunctuationOrSymbol(_In_ CTextBackingStoreNavigator& navigator) const
+    {
+        const wchar_t character = navigator.GetCharacter();
+        const CPlainTextPosition& plainPosition = navigator.GetPosition().GetPlainPosition();
+        uint32_t offset = 0;
+
+        // Surrogates are classified on their own, like IsXamlPunctuationOrSymbol does, rather than as a pair.
+        if (!IS_SURROGATE(character) &&
+            plainPosition.GetTextView() != nullptr &&
+            SUCCEEDED(plainPosition.GetOffset(&offset)))
+        {
+            const int index = plainPosition.GetTextView()->GetCharacterIndex(offset);
+
+            if (index >= 0 &&
+                static_cast<size_t>(index) < m_categories.size() &&
+                m_text[index] == character)
+            {
+                return IsPunctuationOrSymbolCategory(static_cast<GeneralCategory>(m_categories[index]));
+            }
+        }
+
+        return !!IsXamlPunctuationOrSymbol(character);
+    }
+
+private:
+    const wchar_t* m_text;
+    std::vector<uint8_t> m_categories;
+};
+
+
 // Given a potential break position and list of valid breaks, returns
 // whether a break for text selection is allowed at that position.
 bool CSelectionWordBreaker::IsSelectionBreak(
@@ -457,15 +505,16 @@ _Check_return_ HRESULT CSelectionWordBreaker::GetAdjacentWordSelectionBoundary(
     HSTRING containerText = wrl::Wrappers::HStringReference(characters, totalCharacters).Get();
 
     const std::vector<uint32_t>& breakOffsets = GetTextSegments(containerText, currentPosition.GetPlainPosition().GetTextContainer());
+    const CTextCategories textCategories(characters, totalCharacters);
 
     if (IsForwardDirection(findType))
     {
         // Forwards
-        if (IsXamlPunctuationOrSymbol(navigator.GetCharacter()))
+        if (textCategories.IsPunctuationOrSymbol(navigator))
         {
             // A contiguous sequence of punctuation signs should be considered a whole word
             while (    fMoved
-                   &&  IsXamlPunctuationOrSymbol(navigator.GetCharacter()))
+                   &&  textCategories.IsPunctuationOrSymbol(navigator))
             {
                 fMoved = navigator.MoveNext();
             }
@@ -525,11 +574,11 @@ _Check_return_ HRESULT CSelectionWordBreaker::GetAdjacentWordSelectionBoundary(
     else
     {
         // Backwards
-        if (IsXamlPunctuationOrSymbol(navigator.GetCharacter()))
+        if (textCategories.IsPunctuationOrSymbol(navigator))
         {
             // A contiguous sequence of punctuation signs should be considered a whole word
             while (    fMoved
-                   &&  IsXamlPunctuationOrSymbol(navigator.GetCharacter()))
+                   &&  textCategories.IsPunctuationOrSymbol(navigator))
             {
                 fMoved = navigator.MovePrevious();
             }
@@ -192,6 +192,47 @@ HRESULT CTextCore::ConfigureNumberSubstitution()
 
     return S_OK;
 }
+//------------------------------------------------------------------------
+//
+//  Remembers a text control whose block layout stopped formatting a long
+//  paragraph partway, and asks for another frame to continue it.
+//
+//------------------------------------------------------------------------
+void CTextCore::RegisterDeferredLineFormatting(_In_ CFrameworkElement *pOwner)
+{
+    auto weakOwner = xref::get_weakref(pOwner);
+
+    if (std::find(m_deferredLineFormattingOwners.begin(), m_deferredLineFormattingOwners.end(), weakOwner) == m_deferredLineFormattingOwners.end())
+    {
+        m_deferredLineFormattingOwners.push_back(std::move(weakOwner));
+    }
+
+    m_pCore->RequestAdditionalFrame(RequestFrameReason::PhasedWork);
+}
+
+//------------------------------------------------------------------------
+//
+//  Invalidates the measure of the text controls with deferred lines, so
+//  the next layout pass formats another batch of them. Controls that still
+//  have lines left after that register again.
+//
+//------------------------------------------------------------------------
+void CTextCore::ResumeDeferredLineFormatting()
+{
+    std::vector<xref::weakref_ptr<CFrameworkElement>> owners;
+    owners.swap(m_deferredLineFormattingOwners);
+
+    for (const auto& weakOwner : owners)
+    {
+        xref_ptr<CFrameworkElement> owner = weakOwner.lock();
+
+        if (owner)
+        {
+            owner->InvalidateMeasure();
+        }
+    }
+}
+
 //------------------------------------------------------------------------
 //
 //  Determines whether a given control is a text control
@@ -366,7 +366,7 @@ DependencyObjectPropertyAccess::ResolvePropertyName(
 {
     HRESULT hr = S_OK;
 
-    IFC(MetadataAPI::TryGetDependencyPropertyByName(
+    IFC(MetadataAPI::TryGetDependencyPropertyForBindingPathStep(
         pSourceType,
         XSTRING_PTR_EPHEMERAL2(
             szPropertyName,
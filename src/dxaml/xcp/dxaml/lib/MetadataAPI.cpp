@@ -262,6 +262,10 @@ _Check_return_ HRESULT MetadataAPI::RegisterDependencyProperty(
 
     storage->m_queuedDPRegistrations->emplace(DynamicMetadataStorage::DPRegistrationInfo(pDP, propertyType.Kind, propertyTypeName, ownerType.Kind, ownerTypeName, pDefaultMetadata));
 
+    // Binding path steps that didn't resolve to a DP before may resolve to this one.
+    storage->m_bindingPathStepsByTypeAndNameCache = nullptr;
+    ++storage->m_bindingPathStepsGeneration;
+
     // Add the DP to the main runtime property cache. The property index we just acquired is based on
     // the assumption that we're immediately inserting into the property cache.
     storage->m_customPropertiesCache.push_back(pDP);
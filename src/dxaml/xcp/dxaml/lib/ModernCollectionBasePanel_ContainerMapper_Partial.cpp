@@ -345,6 +345,11 @@ _Check_return_ HRESULT ModernCollectionBasePanel::ContainerManager::PlaceInValid
         TracePlaceElementEnd();
     });
 
+    if (type == xaml_controls::ElementType_ItemContainer)
+    {
+        InvalidateValidContainersByItem();
+    }
+
     ctl::WeakRefPtr weakRef;
     IFC_RETURN(ctl::ComPtr<IUIElement>(spElement).AsWeak(&weakRef));
 
@@ -454,6 +459,11 @@ _Check_return_ HRESULT ModernCollectionBasePanel::ContainerManager::RemoveFromVa
 
     ctl::ComPtr<IUIElement> spElement;
 
+    if (type == xaml_controls::ElementType_ItemContainer)
+    {
+        InvalidateValidContainersByItem();
+    }
+
     IFC(GetElementAtValidIndex(type, indexInValidElements, &spElement));
     IFC(RemoveFromVisualChildren(type, dataIndex, spElement, isForDataRemoval));
 
@@ -525,6 +535,11 @@ _Check_return_ HRESULT ModernCollectionBasePanel::ContainerManager::RemoveAllVal
     ctl::ComPtr<wfc::IVector<xaml::UIElement*>> spChildren;
     ctl::ComPtr<IUIElement> spChild;
 
+    if (type == xaml_controls::ElementType_ItemContainer)
+    {
+        InvalidateValidContainersByItem();
+    }
+
     IFC(m_owner->m_cacheManager.GetChildren(&spChildren));
 
     // notify that it is no longer of interest
@@ -1091,23 +1106,39 @@ _Check_return_ HRESULT
 
     if (!itemMatch)
     {
-        // fallback logic (slower)
-        auto elementIterator = std::find_if(begin(m_validElements[type]), end(m_validElements[type]),
-            [dataItem] (ctl::WeakRefPtr weakRef)
+        ctl::ComPtr<IUIElement> spFoundElement;
+        bool handled = false;
+
+        if (type == xaml_controls::ElementType_ItemContainer)
         {
-            ctl::ComPtr<IUIElement> spCandidateElement = weakRef.AsOrNull<IUIElement>();
-            if (spCandidateElement)
+            IFC(TryGetValidContainerForItem(dataItem, &spFoundElement, &handled));
+        }
+
+        if (!handled)
+        {
+            // fallback logic (slower)
+            auto elementIterator = std::find_if(begin(m_validElements[type]), end(m_validElements[type]),
+                [dataItem] (ctl::WeakRefPtr weakRef)
+            {
+                ctl::ComPtr<IUIElement> spCandidateElement = weakRef.AsOrNull<IUIElement>();
+                if (spCandidateElement)
+                {
+                    bool areEqual = false;
+                    VERIFYHR(PropertyValue::AreEqual(GetItemFromElement(spCandidateElement).Get(), dataItem, &areEqual));
+                    return areEqual;
+                }
+                return false;
+            });
+
+            if (end(m_validElements[type]) != elementIterator)
             {
-                bool areEqual = false;
-                VERIFYHR(PropertyValue::AreEqual(GetItemFromElement(spCandidateElement).Get(), dataItem, &areEqual));
-                return areEqual;
+                spFoundElement = (*elementIterator).AsOrNull<IUIElement>();
             }
-            return false;
-        });
+        }
 
-        if (end(m_validElements[type]) != elementIterator)
+        if (spFoundElement)
         {
-            IFC((*elementIterator).CopyTo(ppReturnValue));
+            IFC(spFoundElement.CopyTo(ppReturnValue));
         }
         else
         {
@@ -1155,6 +1186,95 @@ Cleanup:
     RRETURN(hr);
 }
 
+_Check_return_ HRESULT
+    ModernCollectionBasePanel::ContainerManager::TryGetValidContainerForItem(
+    _In_ IInspectable* pItem,
+    _Out_ ctl::ComPtr<IUIElement>* pspContainer,
+    _Out_ bool* pHandled)
+{
+    ctl::ComPtr<wf::IPropertyValue> spItemAsPV;
+
+    *pspContainer = nullptr;
+    *pHandled = false;
+
+    if (!pItem)
+    {
+        return S_OK;
+    }
+
+    // Boxed values are equal by value, those still need the search.
+    spItemAsPV.Attach(ctl::get_property_value(pItem));
+    if (spItemAsPV)
+    {
+        return S_OK;
+    }
+
+    if (m_areValidContainersByItemStale)
+    {
+        m_validContainersByItem.clear();
+
+        for (const auto& weakRef : m_validElements[xaml_controls::ElementType_ItemContainer])
+        {
+            ctl::ComPtr<IUIElement> spElement = weakRef.AsOrNull<IUIElement>();
+            if (spElement)
+            {
+                ctl::ComPtr<IInspectable> spElementItem = GetItemFromElement(spElement);
+                if (spElementItem)
+                {
+                    ctl::ComPtr<IUnknown> spIdentity;
+                    IFC_RETURN(spElementItem.As(&spIdentity));
+
+                    // Keep the first container of an item, as the search would.
+                    m_validContainersByItem.emplace(spIdentity.Get(), weakRef);
+                }
+            }
+        }
+
+        m_areValidContainersByItemStale = false;
+    }
+
+    ctl::ComPtr<IUnknown> spIdentity;
+    IFC_RETURN(ctl::ComPtr<IInspectable>(pItem).As(&spIdentity));
+
+    auto itr = m_validContainersByItem.find(spIdentity.Get());
+    if (itr != m_validContainersByItem.end())
+    {
+        ctl::ComPtr<IUIElement> spElement = itr->second.AsOrNull<IUIElement>();
+
+        // The entry is stale if the container went away or got another item. Let the search
+        // answer and rebuild the map next time.
+        if (!spElement || !ctl::are_equal(GetItemFromElement(spElement).Get(), pItem))
+        {
+            m_areValidContainersByItemStale = true;
+            return S_OK;
+        }
+
+        *pspContainer = std::move(spElement);
+    }
+    else
+    {
+        // The map should hold every valid container, but a missed invalidation must not make
+        // ContainerFromItem fail, so a miss is confirmed by the search.
+        auto elementIterator = std::find_if(begin(m_validElements[xaml_controls::ElementType_ItemContainer]), end(m_validElements[xaml_controls::ElementType_ItemContainer]),
+            [pItem] (const ctl::WeakRefPtr& weakRef)
+        {
+            ctl::ComPtr<IUIElement> spCandidateElement = weakRef.AsOrNull<IUIElement>();
+            return spCandidateElement && ctl::are_equal(GetItemFromElement(spCandidateElement).Get(), pItem);
+        });
+
+        if (end(m_validElements[xaml_controls::ElementType_ItemContainer]) != elementIterator)
+        {
+            ASSERT(false, L"m_validContainersByItem is missing a valid container");
+            m_areValidContainersByItemStale = true;
+            *pspContainer = (*elementIterator).AsOrNull<IUIElement>();
+        }
+    }
+
+    *pHandled = true;
+
+    return S_OK;
+}
+
 _Check_return_ HRESULT ModernCollectionBasePanel::ContainerManager::Interface_GroupHeaderContainerFromItemContainerImpl(
     _In_ xaml::IDependencyObject* pItemContainer,
     _Outptr_result_maybenull_ xaml::IDependencyObject** ppReturnValue)
@@ -1524,6 +1644,12 @@ _Check_return_ HRESULT ModernCollectionBasePanel::ContainerManager::OnDataItemRe
 {
     ctl::WeakRefPtr newWeakRef;
     ctl::ComPtr<wfc::IVector<xaml::UIElement*>> spChildren;
+
+    if (type == xaml_controls::ElementType_ItemContainer)
+    {
+        InvalidateValidContainersByItem();
+    }
+
     IFC_RETURN(ctl::AsWeak(pNewElement, &newWeakRef));
     INT32 childIndex = StartOfGarbageSection();
 
@@ -936,6 +936,7 @@ _Check_return_ HRESULT ModernCollectionBasePanel::LinkContainerToItem(_In_ const
 
     // linking the item to the container
     IFC(SetItemForElement(spContainer, spItem));
+    m_containerManager.InvalidateValidContainersByItem();
 
     // todo: decide if we still want to set datacontext here
 
@@ -973,6 +974,7 @@ _Check_return_
         UIElement::VirtualizationInformation* p_virtualizationInformation = GetVirtualizationInformationFromElement(spContainer);
         *pspItem = p_virtualizationInformation->GetItem();
         IFC(p_virtualizationInformation->SetItem(nullptr));
+        m_containerManager.InvalidateValidContainersByItem();
     }
 
 Cleanup:
@@ -683,6 +683,9 @@ namespace DirectUI
             // Returns True if there is a realized item in the valid collection for the provided index.
             bool IsItemConnected(_In_ UINT index) const;
 
+            // Must be called whenever an item gets linked to or unlinked from a container.
+            void InvalidateValidContainersByItem() { m_areValidContainersByItemStale = true; }
+
             // Returns True if the group header for the provided index is connected.
             bool IsGroupHeaderConnected(_In_ UINT groupIndex, _In_ UINT neighboringItemIndex) const;
 
@@ -923,6 +926,13 @@ namespace DirectUI
             // Helper to trim one type of sentinel
             void TrimEdgeSentinels(_In_ xaml_controls::ElementType type);
 
+            // Looks up the valid container of an item by identity. Sets pHandled to false when the item
+            // can only be compared by value, and a search through the valid range is needed instead.
+            _Check_return_ HRESULT TryGetValidContainerForItem(
+                _In_ IInspectable* pItem,
+                _Out_ ctl::ComPtr<IUIElement>* pspContainer,
+                _Out_ bool* pHandled);
+
 
         private:
             // The valid range of containers and headers we use to maintain easy index-to-element lookups
@@ -933,6 +943,13 @@ namespace DirectUI
             // perf optimization: last found indices
             std::array<INT32, ElementType_Count> m_lastFoundIndexElements;
 
+            // perf optimization: the valid containers keyed by the identity of their item, so that
+            // ContainerFromItem finds realized items without searching the valid range. Misses are
+            // still confirmed by the search. The identities are not AddRef'd and are only compared.
+            // Rebuilt on the next lookup once stale.
+            std::unordered_map<IUnknown*, ctl::WeakRefPtr> m_validContainersByItem;
+            bool m_areValidContainersByItemStale = true;
+
             // Maps each child element to their index in the item collection
             // Should always be the same size as the corresponding region in the children collection
             // We keep this map around to easily and quickly map elements to the chidlren collection
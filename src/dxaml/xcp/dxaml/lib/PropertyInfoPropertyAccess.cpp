@@ -188,7 +188,7 @@ _Check_return_ HRESULT PropertyInfoPropertyAccess::CreateInstance(
     }
 
     // Now try to resolve the property by name.
-    IFC(MetadataAPI::TryGetPropertyByName(pSourceType, XSTRING_PTR_EPHEMERAL2(pszPropertyName, xstrlen(pszPropertyName)), &pProperty));
+    IFC(MetadataAPI::TryGetPropertyForBindingPathStep(pSourceType, XSTRING_PTR_EPHEMERAL2(pszPropertyName, xstrlen(pszPropertyName)), &pProperty));
     if (pProperty == nullptr)
     {
         // We failed to find the property, bail out.
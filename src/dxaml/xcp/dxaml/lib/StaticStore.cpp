@@ -8,6 +8,9 @@
 #include "StaticStore.h"
 #include "RoutedEvent.g.h"
 #include <CStaticLock.h>
+#include "TypeTableStructs.h"
+#include "Enums.g.h"
+#include <cmath>
 
 using namespace ::Windows::Internal;
 using namespace DirectUI;
@@ -41,6 +44,14 @@ xref_ptr<StaticStore> StaticStore::GetInstance()
     return xref_ptr<StaticStore>(g_pStaticStore);
 }
 
+StaticStore::~StaticStore()
+{
+    for (auto& entry : m_enumValueCache)
+    {
+        delete entry.load(std::memory_order_relaxed);
+    }
+}
+
 unsigned int StaticStore::AddRef()
 {
     CStaticLock lock;
@@ -72,10 +83,13 @@ _Check_return_ HRESULT StaticStore::Initialize()
     IFC_RETURN(m_spValueFactory->CreateBoolean(FALSE, &m_spFalseValue));
     IFC_RETURN(m_spValueFactory->CreateSingle(0.0f, &m_spSingle));
     IFC_RETURN(m_spValueFactory->CreateDouble(0.0, &m_spDouble));
+    IFC_RETURN(m_spValueFactory->CreateDouble(1.0, &m_spDoubleOne));
     IFC_RETURN(m_spValueFactory->CreateChar16(L'\0', &m_spChar));
     IFC_RETURN(m_spValueFactory->CreateInt16(0, &m_spInt16));
     IFC_RETURN(m_spValueFactory->CreateUInt16(0, &m_spUInt16));
     IFC_RETURN(m_spValueFactory->CreateInt32(0, &m_spInt32));
+    IFC_RETURN(m_spValueFactory->CreateInt32(1, &m_spInt32One));
+    IFC_RETURN(m_spValueFactory->CreateString(nullptr, &m_spEmptyString));
     IFC_RETURN(m_spValueFactory->CreateUInt32(0, &m_spUInt32));
     IFC_RETURN(m_spValueFactory->CreateInt64(0, &m_spInt64));
     IFC_RETURN(m_spValueFactory->CreateUInt64(0, &m_spUInt64));
@@ -138,6 +152,146 @@ _Check_return_ HRESULT StaticStore::GetBoolean(_In_ BOOLEAN bValue, _Outptr_ IIn
     return S_OK;
 }
 
+_Check_return_ HRESULT StaticStore::GetInt32(_In_ INT32 nValue, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    if (nValue == 0)
+    {
+        IFC_RETURN(store->m_spInt32.CopyTo(ppValue));
+    }
+    else if (nValue == 1)
+    {
+        IFC_RETURN(store->m_spInt32One.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreateInt32(nValue, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetDouble(_In_ DOUBLE nValue, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    // -0.0 compares equal to 0.0, but has to keep its sign.
+    if (nValue == 0.0 && !std::signbit(nValue))
+    {
+        IFC_RETURN(store->m_spDouble.CopyTo(ppValue));
+    }
+    else if (nValue == 1.0)
+    {
+        IFC_RETURN(store->m_spDoubleOne.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreateDouble(nValue, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetString(_In_opt_ HSTRING hString, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    if (WindowsGetStringLen(hString) == 0)
+    {
+        IFC_RETURN(store->m_spEmptyString.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreateString(hString, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetPoint(_In_ wf::Point value, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    if (value.X == 0.0f && value.Y == 0.0f && !std::signbit(value.X) && !std::signbit(value.Y))
+    {
+        IFC_RETURN(store->m_spPoint.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreatePoint(value, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetSize(_In_ wf::Size value, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    if (value.Width == 0.0f && value.Height == 0.0f && !std::signbit(value.Width) && !std::signbit(value.Height))
+    {
+        IFC_RETURN(store->m_spSize.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreateSize(value, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetRect(_In_ wf::Rect value, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+
+    if (value.X == 0.0f && value.Y == 0.0f && value.Width == 0.0f && value.Height == 0.0f &&
+        !std::signbit(value.X) && !std::signbit(value.Y) && !std::signbit(value.Width) && !std::signbit(value.Height))
+    {
+        IFC_RETURN(store->m_spRect.CopyTo(ppValue));
+    }
+    else
+    {
+        IFC_RETURN(store->m_spValueFactory->CreateRect(value, ppValue));
+    }
+
+    return S_OK;
+}
+
+_Check_return_ HRESULT StaticStore::GetEnumValue(_In_ UINT nValue, _In_ const CClassInfo* pType, _Outptr_ IInspectable** ppValue)
+{
+    auto store = GetInstance();
+    const KnownTypeIndex typeIndex = pType->GetIndex();
+    auto& slot = store->m_enumValueCache[(static_cast<size_t>(typeIndex) * 31 + nValue) % s_enumValueCacheSize];
+
+    CachedEnumValue* pEntry = slot.load(std::memory_order_acquire);
+
+    if (pEntry && pEntry->typeIndex == typeIndex && pEntry->value == nValue)
+    {
+        IFC_RETURN(pEntry->spBox.CopyTo(ppValue));
+        return S_OK;
+    }
+
+    ctl::ComPtr<IInspectable> spBox;
+    IFC_RETURN(GetKnownWinRTBoxFromEnumValue(nValue, pType, &spBox));
+
+    if (!pEntry)
+    {
+        std::unique_ptr<CachedEnumValue> spNewEntry(new CachedEnumValue{ typeIndex, nValue, spBox });
+
+        // Another thread may have filled the slot in the meantime, in which case the box we just
+        // made is returned uncached.
+        if (slot.compare_exchange_strong(pEntry, spNewEntry.get(), std::memory_order_release, std::memory_order_acquire))
+        {
+            spNewEntry.release();
+        }
+    }
+
+    *ppValue = spBox.Detach();
+
+    return S_OK;
+}
+
 _Check_return_ HRESULT StaticStore::GetUnsetValue(_Outptr_ IInspectable **ppUnsetValue)
 {
     IFC_RETURN(GetInstance()->m_spUnsetValue.CopyTo(ppUnsetValue));
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <atomic>
+
+class CClassInfo;
+
 namespace DirectUI
 {
     class RoutedEvent;
@@ -24,6 +28,8 @@ namespace DirectUI
         static HRESULT EnsureStaticStore();
 
     public:
+        ~StaticStore();
+
         static xref_ptr<StaticStore> GetInstance();
 
         // Ref counting for the singleton.
@@ -32,6 +38,18 @@ namespace DirectUI
 
         static _Check_return_ HRESULT GetBoolean(_In_ BOOLEAN bValue, _Outptr_ IInspectable** ppValue);
 
+        // Box the values that property changes see most often (zero, one and empty) with shared
+        // immutable boxes, and everything else with new ones.
+        static _Check_return_ HRESULT GetInt32(_In_ INT32 nValue, _Outptr_ IInspectable** ppValue);
+        static _Check_return_ HRESULT GetDouble(_In_ DOUBLE nValue, _Outptr_ IInspectable** ppValue);
+        static _Check_return_ HRESULT GetString(_In_opt_ HSTRING hString, _Outptr_ IInspectable** ppValue);
+        static _Check_return_ HRESULT GetPoint(_In_ wf::Point value, _Outptr_ IInspectable** ppValue);
+        static _Check_return_ HRESULT GetSize(_In_ wf::Size value, _Outptr_ IInspectable** ppValue);
+        static _Check_return_ HRESULT GetRect(_In_ wf::Rect value, _Outptr_ IInspectable** ppValue);
+
+        // Boxes of known enums are created once per type and value, and shared after that.
+        static _Check_return_ HRESULT GetEnumValue(_In_ UINT nValue, _In_ const CClassInfo* pType, _Outptr_ IInspectable** ppValue);
+
         static _Check_return_ HRESULT GetDefaultValue(_In_ KnownTypeIndex nTypeIndex, _Outptr_ IInspectable** ppValue);
 
         static _Check_return_ HRESULT GetUnsetValue(_Outptr_ IInspectable **ppUnsetValue);
@@ -81,16 +99,31 @@ namespace DirectUI
         static _Check_return_ HRESULT GetContextRequestedEvent(_Outptr_ xaml::IRoutedEvent** ppRoutedEvent);
 
     private:
+        struct CachedEnumValue
+        {
+            KnownTypeIndex typeIndex;
+            UINT value;
+            ctl::ComPtr<IInspectable> spBox;
+        };
+
+        // Entries are only ever added, and don't change once they're published, so lookups
+        // don't need the lock. An entry whose slot is taken just isn't cached.
+        static constexpr size_t s_enumValueCacheSize = 1024;
+        std::atomic<CachedEnumValue*> m_enumValueCache[s_enumValueCacheSize] = {};
+
         ctl::ComPtr<wf::IPropertyValueStatics> m_spValueFactory;
         ctl::ComPtr<wf::IUriRuntimeClassFactory> m_spUriFactory;
         ctl::ComPtr<IInspectable> m_spTrueValue;
         ctl::ComPtr<IInspectable> m_spFalseValue;
         ctl::ComPtr<IInspectable> m_spSingle;
         ctl::ComPtr<IInspectable> m_spDouble;
+        ctl::ComPtr<IInspectable> m_spDoubleOne;
         ctl::ComPtr<IInspectable> m_spChar;
         ctl::ComPtr<IInspectable> m_spInt16;
         ctl::ComPtr<IInspectable> m_spUInt16;
         ctl::ComPtr<IInspectable> m_spInt32;
+        ctl::ComPtr<IInspectable> m_spInt32One;
+        ctl::ComPtr<IInspectable> m_spEmptyString;
         ctl::ComPtr<IInspectable> m_spUInt32;
         ctl::ComPtr<IInspectable> m_spInt64;
         ctl::ComPtr<IInspectable> m_spUInt64;
@@ -70,11 +70,54 @@ IFACEMETHODIMP VectorCollectionView::IndexOf(
     _Out_ BOOLEAN *found)
 {
     HRESULT hr = S_OK;
+    IUnknown* pIdentity = nullptr;
 
     ARG_VALIDRETURNPOINTER(index);
     ARG_VALIDRETURNPOINTER(found);
+
+    *index = 0;
+    *found = FALSE;
+
+    // Where the source found an item is remembered by identity until the source changes, and
+    // only used if the source still has that same item there. Everything else, including boxed
+    // values, which are equal by value, is answered by the source.
+    if (m_epVectorChangedHandler && value)
+    {
+        ctl::ComPtr<wf::IPropertyValue> spValueAsPV;
+        spValueAsPV.Attach(ctl::get_property_value(value));
+
+        if (!spValueAsPV)
+        {
+            IFC(GetItemIdentity(value, &pIdentity));
+
+            auto itr = m_indexHintsByIdentity.find(pIdentity);
+            if (itr != m_indexHintsByIdentity.end())
+            {
+                ctl::ComPtr<IInspectable> spItem;
+                IUnknown* pItemIdentity = nullptr;
+
+                IFC(m_tpSource->GetAt(itr->second, &spItem));
+                IFC(GetItemIdentity(spItem.Get(), &pItemIdentity));
+
+                if (pItemIdentity == pIdentity)
+                {
+                    *index = itr->second;
+                    *found = TRUE;
+                    goto Cleanup;
+                }
+
+                m_indexHintsByIdentity.erase(itr);
+            }
+        }
+    }
+
     IFC(m_tpSource->IndexOf(value, index, found));
 
+    if (*found && pIdentity)
+    {
+        m_indexHintsByIdentity.emplace(pIdentity, *index);
+    }
+
 Cleanup:
 
     RRETURN(hr);
@@ -185,6 +228,8 @@ HRESULT VectorCollectionView::OnSourceVectorChanged(
 
     IFC(ctl::do_query_interface(pActualArgs, pArgs));
 
+    IFC(UpdateIndexHints(pActualArgs));
+
     IFC(ProcessCollectionChange(pActualArgs));
 
 Cleanup:
@@ -194,6 +239,73 @@ Cleanup:
     RRETURN(hr);
 }
 
+// Shifts the IndexOf hints past an insertion or removal, and drops the hints for the items that
+// were removed or replaced. A Reset drops them all.
+_Check_return_
+HRESULT VectorCollectionView::UpdateIndexHints(_In_ wfc::IVectorChangedEventArgs *pArgs)
+{
+    wfc::CollectionChange change = wfc::CollectionChange_Reset;
+    UINT changeIndex = 0;
+
+    if (m_indexHintsByIdentity.empty())
+    {
+        return S_OK;
+    }
+
+    IFC_RETURN(pArgs->get_CollectionChange(&change));
+    IFC_RETURN(pArgs->get_Index(&changeIndex));
+
+    switch (change)
+    {
+    case wfc::CollectionChange_ItemInserted:
+        for (auto& hint : m_indexHintsByIdentity)
+        {
+            if (hint.second >= changeIndex)
+            {
+                ++hint.second;
+            }
+        }
+        break;
+
+    case wfc::CollectionChange_ItemRemoved:
+        for (auto itr = m_indexHintsByIdentity.begin(); itr != m_indexHintsByIdentity.end();)
+        {
+            if (itr->second == changeIndex)
+            {
+                itr = m_indexHintsByIdentity.erase(itr);
+                continue;
+            }
+
+            if (itr->second > changeIndex)
+            {
+                --itr->second;
+            }
+            ++itr;
+        }
+        break;
+
+    case wfc::CollectionChange_ItemChanged:
+        for (auto itr = m_indexHintsByIdentity.begin(); itr != m_indexHintsByIdentity.end();)
+        {
+            if (itr->second == changeIndex)
+            {
+                itr = m_indexHintsByIdentity.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+        break;
+
+    default:
+        m_indexHintsByIdentity.clear();
+        break;
+    }
+
+    return S_OK;
+}
+
 _Check_return_
 HRESULT VectorCollectionView::SetSource(_In_ wfc::IVector<IInspectable *> *pSource)
 {
@@ -201,6 +313,7 @@ HRESULT VectorCollectionView::SetSource(_In_ wfc::IVector<IInspectable *> *pSour
     ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spObservable;
 
     SetPtrValue(m_tpSource, pSource);
+    m_indexHintsByIdentity.clear();
 
     // Capture the virtualization interface
     SetPtrValueWithQIOrNull(m_tpSupportIncrementalLoading, m_tpSource.Get());
@@ -234,6 +347,24 @@ Cleanup:
     RRETURN(hr);
 }
 
+// Items are compared by COM identity. The returned pointer is not AddRef'd.
+_Check_return_
+HRESULT VectorCollectionView::GetItemIdentity(
+    _In_opt_ IInspectable *pItem,
+    _Out_ IUnknown **ppIdentity)
+{
+    *ppIdentity = nullptr;
+
+    if (pItem)
+    {
+        ctl::ComPtr<IUnknown> spIdentity;
+        IFC_RETURN(pItem->QueryInterface(IID_PPV_ARGS(&spIdentity)));
+        *ppIdentity = spIdentity.Get();
+    }
+
+    return S_OK;
+}
+
 // Factory static method
 _Check_return_
 HRESULT VectorCollectionView::CreateInstance(
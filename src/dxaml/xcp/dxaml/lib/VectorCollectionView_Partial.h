@@ -66,10 +66,19 @@ namespace DirectUI
             _In_ wfc::IObservableVector<IInspectable *> *pSender,
             _In_ IInspectable *pArgs);
 
+        _Check_return_ HRESULT UpdateIndexHints(_In_ wfc::IVectorChangedEventArgs *pArgs);
+
+        static _Check_return_ HRESULT GetItemIdentity(_In_opt_ IInspectable *pItem, _Out_ IUnknown **ppIdentity);
+
     private:
 
         TrackerPtr<wfc::IVector<IInspectable *>> m_tpSource;
         TrackerPtr<xaml_data::ISupportIncrementalLoading> m_tpSupportIncrementalLoading;
         ctl::EventPtr<VectorChangedEventCallback> m_epVectorChangedHandler;
+
+        // Where the source's IndexOf found items, by identity. Kept in step with the source's changes
+        // and cleared on a Reset, and a hint is still checked against the source before it's used. The identities are not AddRef'd,
+        // they're only compared.
+        std::unordered_map<IUnknown*, UINT> m_indexHintsByIdentity;
     };
 }
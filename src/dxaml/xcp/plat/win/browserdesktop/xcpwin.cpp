@@ -6,6 +6,7 @@
 #include "DirectManipulationService.h"
 
 #include "XcpAllocation.h"
+#include "XcpSlabAllocator.h"
 
 // Enable a bunch of host features (should be in host)
 
@@ -174,6 +175,14 @@ ObtainPlatformServices(
             ghHeap = GetProcessHeap();
         }
 
+        // Core objects are created and destroyed in large numbers while parsing and instantiating templates,
+        // and slabs keep them off the general purpose heap. It's turned on before any core exists so that all
+        // of their objects come from slabs.
+        if (runtimeEnabledFeatureDetector->IsFeatureEnabled(RuntimeFeatureBehavior::RuntimeEnabledFeature::UseSlabAllocator, true))
+        {
+            XcpAllocation::EnableSlabAllocator();
+        }
+
 #if XCP_MONITOR
         g_pThreadMonitor = &theonlyThreadMonitor;
 